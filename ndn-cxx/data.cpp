@@ -31,6 +31,8 @@ BOOST_CONCEPT_ASSERT((WireDecodable<Data>));
 static_assert(std::is_base_of<tlv::Error, Data::Error>::value,
               "Data::Error must inherit from tlv::Error");
 
+bool Data::s_lazyDecoding = false;
+
 Data::Data(const Name& name)
   : m_name(name)
 {
@@ -53,18 +55,25 @@ Data::wireEncode(EncodingImpl<TAG>& encoder, bool wantUnsignedPortionOnly) const
   //          SignatureValue
   // (elements are encoded in reverse order)
 
+  if (m_metaInfo.hasError()) {
+    NDN_THROW(Error("MetaInfo element is malformed"));
+  }
+  if (m_signatureInfo.hasError()) {
+    NDN_THROW(Error("SignatureInfo element is malformed"));
+  }
+
   size_t totalLength = 0;
 
   // SignatureValue
   if (!wantUnsignedPortionOnly) {
-    if (!m_signatureInfo) {
+    if (!m_signatureInfo.get()) {
       NDN_THROW(Error("Requested wire format, but Data has not been signed"));
     }
     totalLength += encoder.prependBlock(m_signatureValue);
   }
 
   // SignatureInfo
-  totalLength += m_signatureInfo.wireEncode(encoder, SignatureInfo::Type::Data);
+  totalLength += m_signatureInfo.get().wireEncode(encoder, SignatureInfo::Type::Data);
 
   // Content
   if (hasContent()) {
@@ -72,7 +81,7 @@ Data::wireEncode(EncodingImpl<TAG>& encoder, bool wantUnsignedPortionOnly) const
   }
 
   // MetaInfo
-  totalLength += m_metaInfo.wireEncode(encoder);
+  totalLength += m_metaInfo.get().wireEncode(encoder);
 
   // Name
   totalLength += m_name.wireEncode(encoder);
@@ -141,9 +150,9 @@ Data::wireDecode(const Block& wire)
   }
   m_name.wireDecode(*element);
 
-  m_metaInfo = {};
+  m_metaInfo.set({});
   m_content = {};
-  m_signatureInfo = {};
+  m_signatureInfo.set({});
   m_signatureValue = {};
   m_fullName.clear();
 
@@ -154,7 +163,12 @@ Data::wireDecode(const Block& wire)
         if (lastElement >= 2) {
           NDN_THROW(Error("MetaInfo element is out of order"));
         }
-        m_metaInfo.wireDecode(*element);
+        if (s_lazyDecoding) {
+          m_metaInfo.defer(*element);
+        }
+        else {
+          m_metaInfo.decode(*element);
+        }
         lastElement = 2;
         break;
       }
@@ -170,7 +184,12 @@ Data::wireDecode(const Block& wire)
         if (lastElement >= 4) {
           NDN_THROW(Error("SignatureInfo element is out of order"));
         }
-        m_signatureInfo.wireDecode(*element);
+        if (s_lazyDecoding) {
+          m_signatureInfo.defer(*element);
+        }
+        else {
+          m_signatureInfo.decode(*element);
+        }
         lastElement = 4;
         break;
       }
@@ -193,7 +212,7 @@ Data::wireDecode(const Block& wire)
     }
   }
 
-  if (!m_signatureInfo) {
+  if (!m_signatureInfo.isDeferred() && !m_signatureInfo.get()) {
     NDN_THROW(Error("SignatureInfo element is missing"));
   }
   if (!m_signatureValue.isValid()) {
@@ -235,7 +254,7 @@ Data::setName(const Name& name)
 Data&
 Data::setMetaInfo(const MetaInfo& metaInfo)
 {
-  m_metaInfo = metaInfo;
+  m_metaInfo.set(metaInfo);
   resetWire();
   return *this;
 }
@@ -293,7 +312,7 @@ Data::unsetContent()
 Data&
 Data::setSignatureInfo(const SignatureInfo& info)
 {
-  m_signatureInfo = info;
+  m_signatureInfo.set(info);
   resetWire();
   return *this;
 }
@@ -326,8 +345,9 @@ Data::extractSignedRanges() const
 Data&
 Data::setContentType(uint32_t type)
 {
-  if (type != m_metaInfo.getType()) {
-    m_metaInfo.setType(type);
+  MetaInfo& metaInfo = m_metaInfo.modify();
+  if (type != metaInfo.getType()) {
+    metaInfo.setType(type);
     resetWire();
   }
   return *this;
@@ -336,8 +356,9 @@ Data::setContentType(uint32_t type)
 Data&
 Data::setFreshnessPeriod(time::milliseconds freshnessPeriod)
 {
-  if (freshnessPeriod != m_metaInfo.getFreshnessPeriod()) {
-    m_metaInfo.setFreshnessPeriod(freshnessPeriod);
+  MetaInfo& metaInfo = m_metaInfo.modify();
+  if (freshnessPeriod != metaInfo.getFreshnessPeriod()) {
+    metaInfo.setFreshnessPeriod(freshnessPeriod);
     resetWire();
   }
   return *this;
@@ -346,8 +367,9 @@ Data::setFreshnessPeriod(time::milliseconds freshnessPeriod)
 Data&
 Data::setFinalBlock(optional<name::Component> finalBlockId)
 {
-  if (finalBlockId != m_metaInfo.getFinalBlock()) {
-    m_metaInfo.setFinalBlock(std::move(finalBlockId));
+  MetaInfo& metaInfo = m_metaInfo.modify();
+  if (finalBlockId != metaInfo.getFinalBlock()) {
+    metaInfo.setFinalBlock(std::move(finalBlockId));
     resetWire();
   }
   return *this;
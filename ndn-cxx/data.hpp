@@ -22,6 +22,7 @@
 #ifndef NDN_CXX_DATA_HPP
 #define NDN_CXX_DATA_HPP
 
+#include "ndn-cxx/detail/deferred-element.hpp"
 #include "ndn-cxx/detail/packet-base.hpp"
 #include "ndn-cxx/encoding/block.hpp"
 #include "ndn-cxx/meta-info.hpp"
@@ -117,6 +118,14 @@ public:
   const Name&
   getFullName() const;
 
+  /** @brief Check if the full name has been computed and cached by getFullName()
+   */
+  bool
+  hasFullName() const noexcept
+  {
+    return !m_fullName.empty();
+  }
+
 public: // Data fields
   /** @brief Get name
    */
@@ -133,11 +142,14 @@ public: // Data fields
   setName(const Name& name);
 
   /** @brief Get MetaInfo
+   *
+   *  If decoding of MetaInfo was deferred (see setLazyDecoding()) and has failed, this returns
+   *  an empty MetaInfo.
    */
   const MetaInfo&
   getMetaInfo() const noexcept
   {
-    return m_metaInfo;
+    return m_metaInfo.get();
   }
 
   /** @brief Set MetaInfo
@@ -209,11 +221,14 @@ public: // Data fields
   unsetContent();
 
   /** @brief Get SignatureInfo
+   *
+   *  If decoding of SignatureInfo was deferred (see setLazyDecoding()) and has failed, this
+   *  returns an empty SignatureInfo, whose signature type is invalid.
    */
   const SignatureInfo&
   getSignatureInfo() const noexcept
   {
-    return m_signatureInfo;
+    return m_signatureInfo.get();
   }
 
   /** @brief Set SignatureInfo
@@ -259,7 +274,7 @@ public: // MetaInfo fields
   uint32_t
   getContentType() const
   {
-    return m_metaInfo.getType();
+    return getMetaInfo().getType();
   }
 
   Data&
@@ -268,7 +283,7 @@ public: // MetaInfo fields
   time::milliseconds
   getFreshnessPeriod() const
   {
-    return m_metaInfo.getFreshnessPeriod();
+    return getMetaInfo().getFreshnessPeriod();
   }
 
   Data&
@@ -277,7 +292,7 @@ public: // MetaInfo fields
   const optional<name::Component>&
   getFinalBlock() const
   {
-    return m_metaInfo.getFinalBlock();
+    return getMetaInfo().getFinalBlock();
   }
 
   Data&
@@ -290,7 +305,7 @@ public: // SignatureInfo fields
   int32_t
   getSignatureType() const noexcept
   {
-    return m_signatureInfo.getSignatureType();
+    return getSignatureInfo().getSignatureType();
   }
 
   /** @brief Get KeyLocator
@@ -298,7 +313,45 @@ public: // SignatureInfo fields
   optional<KeyLocator>
   getKeyLocator() const noexcept
   {
-    return m_signatureInfo.hasKeyLocator() ? make_optional(m_signatureInfo.getKeyLocator()) : nullopt;
+    const auto& info = getSignatureInfo();
+    return info.hasKeyLocator() ? make_optional(info.getKeyLocator()) : nullopt;
+  }
+
+public: // lazy decoding
+  static bool
+  getLazyDecoding()
+  {
+    return s_lazyDecoding;
+  }
+
+  /** @brief Enable or disable lazy decoding in wireDecode()
+   *
+   *  When enabled, wireDecode() checks the structure of the outer TLV element and decodes the
+   *  Name, Content, and SignatureValue, but defers decoding of MetaInfo and SignatureInfo until
+   *  they are first accessed. Applications that only look at the Name, such as forwarders and
+   *  proxies, then avoid the cost of decoding the other fields.
+   *
+   *  A malformed deferred element is not reported by wireDecode(). Instead, its accessor returns
+   *  an empty value, which makes getSignatureType() return -1, and modifying the element or
+   *  encoding the packet again throws tlv::Error. hasMalformedElement() detects this case.
+   *
+   *  Lazy decoding is disabled by default.
+   */
+  static void
+  setLazyDecoding(bool b)
+  {
+    s_lazyDecoding = b;
+  }
+
+  /** @brief Check whether a MetaInfo or SignatureInfo whose decoding was deferred is malformed
+   *
+   *  This decodes the deferred elements if they have not been accessed yet. It always returns
+   *  false for a packet decoded without lazy decoding, because wireDecode() would have thrown.
+   */
+  bool
+  hasMalformedElement() const noexcept
+  {
+    return m_metaInfo.hasError() || m_signatureInfo.hasError();
   }
 
 protected:
@@ -309,10 +362,12 @@ protected:
   resetWire();
 
 private:
+  static bool s_lazyDecoding;
+
   Name m_name;
-  MetaInfo m_metaInfo;
+  detail::DeferredElement<MetaInfo> m_metaInfo;
   Block m_content;
-  SignatureInfo m_signatureInfo;
+  detail::DeferredElement<SignatureInfo> m_signatureInfo;
   Block m_signatureValue;
 
   mutable Block m_wire;
@@ -53,13 +53,12 @@ inline
 CancelHandle::CancelHandle() noexcept = default;
 
 /** \brief Cancels an operation automatically upon destruction.
+ *  \tparam HandleT a default-constructible and movable handle type with a `cancel()` method,
+ *                  such as a subclass of CancelHandle
  */
 template<typename HandleT>
 class ScopedCancelHandle
 {
-  static_assert(std::is_convertible<HandleT*, CancelHandle*>::value,
-                "HandleT must publicly derive from CancelHandle");
-
 public:
   ScopedCancelHandle() noexcept;
 
@@ -0,0 +1,199 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_DETAIL_DEFERRED_ELEMENT_HPP
+#define NDN_DETAIL_DEFERRED_ELEMENT_HPP
+
+#include "ndn-cxx/encoding/block.hpp"
+
+#include <atomic>
+#include <mutex>
+
+namespace ndn {
+namespace detail {
+
+/** \brief Get the mutex that serializes deferred decoding of the object at \p addr.
+ *
+ *  Mutexes are taken from a fixed pool, so that objects do not need to hold one each.
+ */
+std::mutex&
+getDeferredDecodingMutex(const void* addr) noexcept;
+
+/** \brief Sub-element of a packet whose decoding may be deferred until it is first accessed.
+ *  \tparam T a default-constructible type with a `wireDecode(const Block&)` method
+ *
+ *  Accessing the value through const methods is safe from multiple threads, as it is for other
+ *  const methods of a packet. If the deferred element is malformed, get() returns a
+ *  default-constructed value and hasError() returns true. Copying does not decode the deferred
+ *  element; the copy decodes it when first accessed.
+ */
+template<typename T>
+class DeferredElement
+{
+public:
+  DeferredElement() = default;
+
+  DeferredElement(const DeferredElement& other)
+  {
+    copyFrom(other);
+  }
+
+  DeferredElement&
+  operator=(const DeferredElement& other)
+  {
+    if (this != &other) {
+      copyFrom(other);
+    }
+    return *this;
+  }
+
+  DeferredElement(DeferredElement&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    : m_value(std::move(other.m_value))
+    , m_wire(std::move(other.m_wire))
+    , m_isDeferred(other.m_isDeferred.load(std::memory_order_relaxed))
+    , m_hasError(other.m_hasError)
+  {
+  }
+
+  DeferredElement&
+  operator=(DeferredElement&& other) noexcept(std::is_nothrow_move_assignable<T>::value)
+  {
+    m_value = std::move(other.m_value);
+    m_wire = std::move(other.m_wire);
+    m_isDeferred.store(other.m_isDeferred.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_hasError = other.m_hasError;
+    return *this;
+  }
+
+  /** \brief Get the value, decoding the deferred element if necessary.
+   */
+  const T&
+  get() const noexcept
+  {
+    if (m_isDeferred.load(std::memory_order_acquire)) {
+      decodeDeferred();
+    }
+    return m_value;
+  }
+
+  /** \brief Get the value for modification.
+   *  \throw tlv::Error the deferred element is malformed
+   */
+  T&
+  modify()
+  {
+    if (hasError()) {
+      m_value.wireDecode(m_wire); // throws the decoding error
+    }
+    return m_value;
+  }
+
+  /** \brief Whether the deferred element, if any, is malformed.
+   */
+  bool
+  hasError() const noexcept
+  {
+    get();
+    return m_hasError;
+  }
+
+  /** \brief Whether decoding is deferred and has not happened yet.
+   */
+  bool
+  isDeferred() const noexcept
+  {
+    return m_isDeferred.load(std::memory_order_acquire);
+  }
+
+  /** \brief Replace the value, discarding any deferred element.
+   */
+  void
+  set(const T& value)
+  {
+    m_value = value;
+    m_wire = {};
+    m_isDeferred.store(false, std::memory_order_relaxed);
+    m_hasError = false;
+  }
+
+  /** \brief Decode \p wire immediately.
+   *  \throw tlv::Error \p wire is malformed
+   */
+  void
+  decode(const Block& wire)
+  {
+    set(T());
+    m_value.wireDecode(wire);
+  }
+
+  /** \brief Defer decoding of \p wire until the value is first accessed.
+   */
+  void
+  defer(const Block& wire)
+  {
+    set(T());
+    m_wire = wire;
+    m_isDeferred.store(true, std::memory_order_release);
+  }
+
+private:
+  /** \brief Copy the state of \p other, which may be decoded concurrently by another thread.
+   */
+  void
+  copyFrom(const DeferredElement& other)
+  {
+    std::lock_guard<std::mutex> lock(getDeferredDecodingMutex(&other));
+    m_value = other.m_value;
+    m_wire = other.m_wire;
+    m_isDeferred.store(other.m_isDeferred.load(std::memory_order_relaxed), std::memory_order_release);
+    m_hasError = other.m_hasError;
+  }
+
+  void
+  decodeDeferred() const noexcept
+  {
+    std::lock_guard<std::mutex> lock(getDeferredDecodingMutex(this));
+    if (!m_isDeferred.load(std::memory_order_relaxed)) {
+      return; // decoded by another thread
+    }
+
+    try {
+      m_value.wireDecode(m_wire);
+      m_wire = {};
+    }
+    catch (const tlv::Error&) {
+      m_value = T();
+      m_hasError = true; // m_wire is kept, so that modify() can report the error
+    }
+    m_isDeferred.store(false, std::memory_order_release);
+  }
+
+private:
+  mutable T m_value;
+  mutable Block m_wire;
+  mutable std::atomic<bool> m_isDeferred{false};
+  mutable bool m_hasError = false;
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_DETAIL_DEFERRED_ELEMENT_HPP
@@ -30,6 +30,7 @@
 #include "ndn-cxx/util/string-helper.hpp"
 
 #include <boost/asio/buffer.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/range/adaptor/reversed.hpp>
 #include <cstring>
 
@@ -327,25 +328,24 @@ Block::parse() const
   if (!m_elements.empty() || value_size() == 0)
     return;
 
-  Buffer::const_iterator begin = value_begin();
-  Buffer::const_iterator end = value_end();
+  boost::container::small_vector<tlv::ElementIndexEntry, 16> index;
+  size_t nIndexed = tlv::indexElements(value(), value_size(), std::back_inserter(index));
 
-  while (begin != end) {
-    Buffer::const_iterator pos = begin;
-
-    uint32_t type = tlv::readType(pos, end);
-    uint64_t length = tlv::readVarNumber(pos, end);
-    if (length > static_cast<uint64_t>(end - pos)) {
-      m_elements.clear();
-      NDN_THROW(Error("TLV-LENGTH of sub-element of type " + to_string(type) +
-                      " exceeds TLV-VALUE boundary of parent block"));
-    }
-    // pos now points to TLV-VALUE of sub element
-
-    Buffer::const_iterator subEnd = pos + length;
-    m_elements.emplace_back(m_buffer, type, begin, subEnd, pos, subEnd);
+  if (nIndexed != value_size()) {
+    // report why the first unindexed sub-element cannot be decoded
+    Buffer::const_iterator pos = value_begin() + nIndexed;
+    uint32_t type = tlv::readType(pos, value_end());
+    tlv::readVarNumber(pos, value_end());
+    NDN_THROW(Error("TLV-LENGTH of sub-element of type " + to_string(type) +
+                    " exceeds TLV-VALUE boundary of parent block"));
+  }
 
-    begin = subEnd;
+  // create sub-elements that share the underlying wire Buffer
+  m_elements.reserve(index.size());
+  for (const auto& entry : index) {
+    m_elements.emplace_back(m_buffer, entry.type,
+                            m_valueBegin + entry.begin, m_valueBegin + entry.end,
+                            m_valueBegin + entry.valueBegin, m_valueBegin + entry.end);
   }
 }
 
@@ -241,6 +241,37 @@ template<typename Iterator>
 uint32_t
 readType(Iterator& begin, Iterator end);
 
+/**
+ * @brief Type and position of a TLV element found by indexElements().
+ *
+ * Positions are offsets from the beginning of the indexed buffer.
+ */
+struct ElementIndexEntry
+{
+  uint32_t type;     ///< TLV-TYPE
+  size_t begin;      ///< position of TLV-TYPE
+  size_t valueBegin; ///< position of TLV-VALUE
+  size_t end;        ///< position just past the end of TLV-VALUE
+};
+
+/**
+ * @brief Locate a sequence of consecutive TLV elements in a single pass.
+ * @tparam OutputIterator an output iterator that accepts ElementIndexEntry
+ *
+ * @param [in]  buf     Pointer to the first octet of the first TLV element
+ * @param [in]  bufSize Size of the buffer
+ * @param [out] out     An entry is written here for each complete TLV element, in order
+ *
+ * @return number of octets occupied by the indexed elements; if this is less than @p bufSize,
+ *         the remaining octets do not begin with a complete and well-formed TLV element
+ *
+ * This function only reads the TLV-TYPE and TLV-LENGTH of each element, and is optimized for
+ * the common case in which both fit in one octet. Sub-elements are not indexed.
+ */
+template<typename OutputIterator>
+size_t
+indexElements(const uint8_t* buf, size_t bufSize, OutputIterator out);
+
 /**
  * @brief Get the number of bytes necessary to hold the value of @p number encoded as VAR-NUMBER.
  */
@@ -449,6 +480,45 @@ readType(Iterator& begin, Iterator end)
   return static_cast<uint32_t>(type);
 }
 
+template<typename OutputIterator>
+size_t
+indexElements(const uint8_t* buf, size_t bufSize, OutputIterator out)
+{
+  const uint8_t* const end = buf + bufSize;
+  const uint8_t* pos = buf;
+
+  while (end - pos >= 2) {
+    const uint8_t* elementBegin = pos;
+    uint64_t type = 0;
+    uint64_t length = 0;
+    if (pos[0] < 253 && pos[1] < 253) {
+      // fast path: one-octet TLV-TYPE and TLV-LENGTH
+      type = pos[0];
+      length = pos[1];
+      pos += 2;
+    }
+    else if (!readVarNumber(pos, end, type) || !readVarNumber(pos, end, length)) {
+      pos = elementBegin;
+      break;
+    }
+
+    if (type == Invalid || type > std::numeric_limits<uint32_t>::max() ||
+        length > static_cast<uint64_t>(end - pos)) {
+      pos = elementBegin;
+      break;
+    }
+
+    *out = ElementIndexEntry{static_cast<uint32_t>(type),
+                             static_cast<size_t>(elementBegin - buf),
+                             static_cast<size_t>(pos - buf),
+                             static_cast<size_t>(pos - buf) + static_cast<size_t>(length)};
+    ++out;
+    pos += length;
+  }
+
+  return static_cast<size_t>(pos - buf);
+}
+
 constexpr size_t
 sizeOfVarNumber(uint64_t number) noexcept
 {
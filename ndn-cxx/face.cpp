@@ -207,6 +207,78 @@ Face::put(lp::Nack nack)
   } IO_CAPTURE_WEAK_IMPL_END
 }
 
+/**
+ * @brief Make a callback that invokes @p callback through @p executor
+ */
+template<typename Callback>
+static Callback
+deliverThrough(const CallbackExecutor& executor, const Callback& callback)
+{
+  if (executor == nullptr || callback == nullptr) {
+    return callback;
+  }
+  // the arguments are copied, because they are only valid during the invocation
+  return [=] (const auto&... args) {
+    executor([=] { callback(args...); });
+  };
+}
+
+/**
+ * @brief Encode @p packet on the calling thread, so that the io_service thread reuses the wire
+ */
+template<typename Packet>
+static void
+encodeForSubmission(const Packet& packet, char pktType)
+{
+  const Block& wire = packet.wireEncode();
+  if (wire.size() > MAX_NDN_PACKET_SIZE) {
+    NDN_THROW(Face::OversizedPacketError(pktType, packet.getName(), wire.size()));
+  }
+}
+
+PendingInterestHandle
+Face::submitInterest(const Interest& interest,
+                     const DataCallback& afterSatisfied,
+                     const NackCallback& afterNacked,
+                     const TimeoutCallback& afterTimeout,
+                     const CallbackExecutor& executor)
+{
+  auto id = m_impl->m_pendingInterestTable.allocateId();
+
+  auto interest2 = make_shared<Interest>(interest);
+  interest2->getNonce();
+  encodeForSubmission(*interest2, 'I');
+
+  m_impl->submit([id, interest2,
+                  onData = deliverThrough(executor, afterSatisfied),
+                  onNack = deliverThrough(executor, afterNacked),
+                  onTimeout = deliverThrough(executor, afterTimeout)] (Impl& impl) {
+    impl.expressInterest(id, interest2, onData, onNack, onTimeout);
+  });
+
+  return PendingInterestHandle(m_impl, id);
+}
+
+void
+Face::submitData(Data data)
+{
+  encodeForSubmission(data, 'D');
+
+  m_impl->submit([data = std::move(data)] (Impl& impl) {
+    impl.putData(data);
+  });
+}
+
+void
+Face::submitNack(lp::Nack nack)
+{
+  encodeForSubmission(nack.getInterest(), 'N');
+
+  m_impl->submit([nack = std::move(nack)] (Impl& impl) {
+    impl.putNack(nack);
+  });
+}
+
 RegisteredPrefixHandle
 Face::setInterestFilter(const InterestFilter& filter, const InterestCallback& onInterest,
                         const RegisterPrefixFailureCallback& onFailure,
@@ -310,12 +382,17 @@ extractLpLocalFields(NetPkt& netPacket, const lp::Packet& lpPacket)
 void
 Face::onReceiveElement(const Block& blockFromDaemon)
 {
-  lp::Packet lpPacket(blockFromDaemon); // bare Interest/Data is a valid lp::Packet,
-                                        // no need to distinguish
+  lp::Packet lpPacket;
+  Block netPacket = blockFromDaemon;
+  if (netPacket.type() != tlv::Interest && netPacket.type() != tlv::Data) {
+    lpPacket.wireDecode(blockFromDaemon);
+
+    // the network-layer packet shares the buffer of the received LpPacket, no copy is made
+    Buffer::const_iterator begin, end;
+    std::tie(begin, end) = lpPacket.get<lp::FragmentField>();
+    netPacket = Block(blockFromDaemon, begin, end);
+  }
 
-  Buffer::const_iterator begin, end;
-  std::tie(begin, end) = lpPacket.get<lp::FragmentField>();
-  Block netPacket(&*begin, std::distance(begin, end));
   switch (netPacket.type()) {
     case tlv::Interest: {
       auto interest = make_shared<Interest>(netPacket);
@@ -59,6 +59,11 @@ typedef function<void(const Interest&, const lp::Nack&)> NackCallback;
  */
 typedef function<void(const Interest&)> TimeoutCallback;
 
+/**
+ * @brief Function that invokes a callback on behalf of Face, such as by posting it to a strand
+ */
+typedef function<void(function<void()>)> CallbackExecutor;
+
 /**
  * @brief Callback invoked when an incoming Interest matches the specified InterestFilter
  */
@@ -363,6 +368,57 @@ public: // producer
   void
   put(lp::Nack nack);
 
+public: // thread-safe submission
+  /**
+   * @brief Express Interest from any thread
+   *
+   * Unlike other methods of Face, the submit methods may be invoked concurrently from any
+   * number of threads, while another thread processes events. Submissions are appended to a
+   * lock-free queue, which is drained in batches on the io_service thread. Submissions from the
+   * same thread are processed in order, but they are not ordered with respect to operations
+   * posted to the io_service by other means.
+   *
+   * The Interest is encoded on the calling thread.
+   *
+   * @param interest the Interest; a copy will be made
+   * @param afterSatisfied function to be invoked if Data is returned
+   * @param afterNacked function to be invoked if Network NACK is returned
+   * @param afterTimeout function to be invoked if neither Data nor Network NACK
+   *                     is returned within InterestLifetime
+   * @param executor if not empty, the callbacks are invoked through this executor instead of
+   *                 directly on the io_service thread; for example, pass a function that posts
+   *                 to a strand or to the worker thread's own event loop
+   * @throw OversizedPacketError encoded Interest size exceeds MAX_NDN_PACKET_SIZE
+   * @return A handle for canceling the pending Interest; canceling is also thread-safe.
+   * @warning The Face must not be destructed while submissions are in progress.
+   */
+  PendingInterestHandle
+  submitInterest(const Interest& interest,
+                 const DataCallback& afterSatisfied,
+                 const NackCallback& afterNacked,
+                 const TimeoutCallback& afterTimeout,
+                 const CallbackExecutor& executor = nullptr);
+
+  /**
+   * @brief Publish Data packet from any thread
+   * @sa submitInterest for the thread-safety guarantees
+   *
+   * The Data is encoded on the calling thread.
+   *
+   * @throw OversizedPacketError encoded Data size exceeds MAX_NDN_PACKET_SIZE
+   */
+  void
+  submitData(Data data);
+
+  /**
+   * @brief Send a network NACK from any thread
+   * @sa submitInterest for the thread-safety guarantees
+   *
+   * @throw OversizedPacketError encoded Nack size exceeds MAX_NDN_PACKET_SIZE
+   */
+  void
+  submitNack(lp::Nack nack);
+
 public: // IO routine
   /**
    * @brief Process any data to receive or call timeout callbacks.
@@ -25,6 +25,7 @@
 #include "ndn-cxx/face.hpp"
 #include "ndn-cxx/impl/interest-filter-record.hpp"
 #include "ndn-cxx/impl/lp-field-tag.hpp"
+#include "ndn-cxx/impl/mpsc-queue.hpp"
 #include "ndn-cxx/impl/pending-interest.hpp"
 #include "ndn-cxx/impl/registered-prefix.hpp"
 #include "ndn-cxx/lp/packet.hpp"
@@ -36,6 +37,7 @@
 #include "ndn-cxx/util/config-file.hpp"
 #include "ndn-cxx/util/logger.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
+#include "ndn-cxx/util/scope.hpp"
 #include "ndn-cxx/util/signal.hpp"
 
 NDN_LOG_INIT(ndn.Face);
@@ -95,7 +97,8 @@ public: // consumer
 
     const Interest& interest2 = *interest;
     auto& entry = m_pendingInterestTable.put(id, std::move(interest), afterSatisfied, afterNacked,
-                                             afterTimeout, ref(m_scheduler));
+                                             afterTimeout, ref(m_scheduler),
+                                             ref(m_pendingInterestIndex));
 
     lp::Packet lpPacket;
     addFieldFromTag<lp::NextHopFaceIdField, lp::NextHopFaceIdTag>(lpPacket, interest2);
@@ -110,11 +113,9 @@ public: // consumer
   void
   asyncRemovePendingInterest(detail::RecordId id)
   {
-    m_face.getIoService().post([id, w = weak_ptr<Impl>{shared_from_this()}] { // use weak_from_this() in C++17
-      auto impl = w.lock();
-      if (impl != nullptr) {
-        impl->m_pendingInterestTable.erase(id);
-      }
+    // submitted rather than posted, so that it cannot overtake a submitted Interest
+    submit([id] (Impl& impl) {
+      impl.m_pendingInterestTable.erase(id);
     });
   }
 
@@ -130,7 +131,8 @@ public: // consumer
   satisfyPendingInterests(const Data& data)
   {
     bool hasAppMatch = false, hasForwarderMatch = false;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
+    auto candidates = m_pendingInterestIndex.findDataCandidates(data);
+    m_pendingInterestTable.removeIf(candidates, [&] (PendingInterest& entry) {
       if (!entry.getInterest()->matchesData(data)) {
         return false;
       }
@@ -157,7 +159,8 @@ public: // consumer
   nackPendingInterests(const lp::Nack& nack)
   {
     optional<lp::Nack> outNack;
-    m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
+    auto candidates = m_pendingInterestIndex.findNackCandidates(nack.getInterest());
+    m_pendingInterestTable.removeIf(candidates, [&] (PendingInterest& entry) {
       if (!nack.getInterest().matchesInterest(*entry.getInterest())) {
         return false;
       }
@@ -188,7 +191,7 @@ public: // producer
   setInterestFilter(detail::RecordId id, const InterestFilter& filter, const InterestCallback& onInterest)
   {
     NDN_LOG_INFO("setting InterestFilter: " << filter);
-    m_interestFilterTable.put(id, filter, onInterest);
+    m_interestFilterTable.put(id, filter, onInterest, ref(m_interestFilterIndex));
   }
 
   void
@@ -206,7 +209,8 @@ public: // producer
   processIncomingInterest(shared_ptr<const Interest> interest)
   {
     const Interest& interest2 = *interest;
-    auto& entry = m_pendingInterestTable.insert(std::move(interest), ref(m_scheduler));
+    auto& entry = m_pendingInterestTable.insert(std::move(interest), ref(m_scheduler),
+                                                ref(m_pendingInterestIndex));
     dispatchInterest(entry, interest2);
   }
 
@@ -268,7 +272,8 @@ public: // prefix registration
         detail::RecordId filterId = 0;
         if (filter) {
           NDN_LOG_INFO("setting InterestFilter: " << *filter);
-          auto& filterRecord = m_interestFilterTable.insert(*filter, onInterest);
+          auto& filterRecord = m_interestFilterTable.insert(*filter, onInterest,
+                                                            ref(m_interestFilterIndex));
           filterId = filterRecord.getId();
         }
         m_registeredPrefixTable.put(id, prefix, options, filterId);
@@ -299,6 +304,50 @@ public: // prefix registration
     });
   }
 
+public: // thread-safe submission
+  /** @brief Execute @p op on the io_service thread; may be invoked from any thread
+   *
+   *  Operations are queued, and one handler is posted to the io_service to execute all
+   *  operations queued before it runs.
+   */
+  void
+  submit(std::function<void(Impl&)> op)
+  {
+    m_submissions.push(std::move(op));
+    scheduleDrainSubmissions();
+  }
+
+private:
+  void
+  scheduleDrainSubmissions()
+  {
+    if (m_isDrainScheduled.exchange(true)) {
+      return;
+    }
+
+    m_face.getIoService().post([w = weak_ptr<Impl>{shared_from_this()}] { // use weak_from_this() in C++17
+      auto impl = w.lock();
+      if (impl != nullptr) {
+        impl->drainSubmissions();
+      }
+    });
+  }
+
+  void
+  drainSubmissions()
+  {
+    // cleared before popping, so that an operation pushed after the last pop schedules a new drain
+    m_isDrainScheduled = false;
+
+    // if an operation throws, the remaining operations are executed by another handler
+    auto guard = make_scope_fail([this] { scheduleDrainSubmissions(); });
+
+    std::function<void(Impl&)> op;
+    while (m_submissions.pop(op)) {
+      op(*this);
+    }
+  }
+
 public: // IO routine
   void
   ensureConnected(bool wantResume)
@@ -348,7 +397,11 @@ private:
   void
   dispatchInterest(PendingInterest& entry, const Interest& interest)
   {
-    m_interestFilterTable.forEach([&] (const InterestFilterRecord& filter) {
+    std::vector<detail::RecordId> candidates;
+    m_interestFilterIndex.collectPrefixesOf(interest.getName(), candidates);
+    std::sort(candidates.begin(), candidates.end()); // invoke filters in the order they were set
+
+    m_interestFilterTable.forEach(candidates, [&] (const InterestFilterRecord& filter) {
       if (!filter.doesMatch(entry)) {
         return;
       }
@@ -411,12 +464,17 @@ private:
   scheduler::ScopedEventId m_processEventsTimeoutEvent;
   nfd::Controller m_nfdController;
 
+  PendingInterestIndex m_pendingInterestIndex; // must be declared before m_pendingInterestTable
   detail::RecordContainer<PendingInterest> m_pendingInterestTable;
+  InterestFilterIndex m_interestFilterIndex; // must be declared before m_interestFilterTable
   detail::RecordContainer<InterestFilterRecord> m_interestFilterTable;
   detail::RecordContainer<RegisteredPrefix> m_registeredPrefixTable;
 
   unique_ptr<boost::asio::io_service::work> m_ioServiceWork; // if thread needs to be preserved
 
+  detail::MpscQueue<std::function<void(Impl&)>> m_submissions;
+  std::atomic<bool> m_isDrainScheduled{false};
+
   friend class Face;
 };
 
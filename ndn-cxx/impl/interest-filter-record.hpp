@@ -22,11 +22,24 @@
 #ifndef NDN_IMPL_INTEREST_FILTER_RECORD_HPP
 #define NDN_IMPL_INTEREST_FILTER_RECORD_HPP
 
+#include "ndn-cxx/impl/name-index.hpp"
 #include "ndn-cxx/impl/pending-interest.hpp"
 #include "ndn-cxx/impl/record-container.hpp"
 
 namespace ndn {
 
+class InterestFilterRecord;
+
+/**
+ * @brief Index of Interest filter records by filter prefix.
+ *
+ * An Interest can only match the filters whose prefix is a prefix of the Interest name, so
+ * dispatching an Interest takes one lookup per name component, regardless of the number of
+ * filters. Filters with a regular expression are indexed by their prefix as well, and their
+ * regular expression is evaluated only when the prefix matches.
+ */
+using InterestFilterIndex = detail::NameIndex<InterestFilterRecord>;
+
 /**
  * @brief Associates an InterestFilter with an Interest callback.
  */
@@ -38,11 +51,20 @@ public:
    *
    * @param filter an InterestFilter that represents what Interest should invoke the callback
    * @param callback invoked when matching Interest is received
+   * @param index index in which the record is registered during its lifetime
    */
-  InterestFilterRecord(const InterestFilter& filter, const InterestCallback& callback)
+  InterestFilterRecord(const InterestFilter& filter, const InterestCallback& callback,
+                       InterestFilterIndex& index)
     : m_filter(filter)
     , m_interestCallback(callback)
+    , m_index(index)
+  {
+    m_index.insert(m_filter.getPrefix(), *this);
+  }
+
+  ~InterestFilterRecord()
   {
+    m_index.erase(m_filter.getPrefix(), *this);
   }
 
   const InterestFilter&
@@ -77,6 +99,7 @@ public:
 private:
   InterestFilter m_filter;
   InterestCallback m_interestCallback;
+  InterestFilterIndex& m_index;
 };
 
 } // namespace ndn
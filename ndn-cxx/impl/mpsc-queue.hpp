@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_IMPL_MPSC_QUEUE_HPP
+#define NDN_IMPL_MPSC_QUEUE_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <atomic>
+
+namespace ndn {
+namespace detail {
+
+/** \brief Unbounded lock-free queue with multiple producers and a single consumer.
+ *  \tparam T element type; must be default-constructible and movable
+ *
+ *  push() may be invoked from any thread. pop() must only be invoked from one thread at a time.
+ *  A push that is in progress may temporarily hide the elements pushed after it from pop().
+ */
+template<typename T>
+class MpscQueue : noncopyable
+{
+private:
+  struct Node
+  {
+    std::atomic<Node*> next{nullptr};
+    T value;
+  };
+
+public:
+  MpscQueue()
+    : m_head(&m_stub)
+    , m_tail(&m_stub)
+  {
+  }
+
+  ~MpscQueue()
+  {
+    T value;
+    while (pop(value)) {
+    }
+    if (m_tail != &m_stub) {
+      delete m_tail;
+    }
+  }
+
+  /** \brief Append \p value to the queue; thread-safe.
+   */
+  void
+  push(T value)
+  {
+    Node* node = new Node;
+    node->value = std::move(value);
+    Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+  }
+
+  /** \brief Remove the first element of the queue, if any.
+   *  \retval true an element was moved into \p value
+   *  \retval false the queue is empty
+   */
+  bool
+  pop(T& value)
+  {
+    Node* tail = m_tail;
+    Node* next = tail->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      return false;
+    }
+
+    // the popped node becomes the new stub
+    value = std::move(next->value);
+    next->value = T();
+    m_tail = next;
+    if (tail != &m_stub) {
+      delete tail;
+    }
+    return true;
+  }
+
+private:
+  std::atomic<Node*> m_head; ///< last pushed node, modified by producers
+  Node* m_tail;              ///< stub node before the first element, modified by the consumer
+  Node m_stub;
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_IMPL_MPSC_QUEUE_HPP
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_IMPL_NAME_INDEX_HPP
+#define NDN_IMPL_NAME_INDEX_HPP
+
+#include "ndn-cxx/name.hpp"
+#include "ndn-cxx/impl/record-container.hpp"
+
+#include <map>
+
+namespace ndn {
+namespace detail {
+
+/** \brief Refers to the first \c size components of \c name, without copying them.
+ */
+struct NamePrefix
+{
+  const Name& name;
+  size_t size;
+};
+
+/** \brief Orders Names and NamePrefixes, allowing lookup of a prefix without creating a Name.
+ */
+struct NamePrefixCompare
+{
+  using is_transparent = void;
+
+  bool
+  operator()(const Name& lhs, const Name& rhs) const
+  {
+    return lhs.compare(rhs) < 0;
+  }
+
+  bool
+  operator()(const Name& lhs, const NamePrefix& rhs) const
+  {
+    return lhs.compare(0, Name::npos, rhs.name, 0, rhs.size) < 0;
+  }
+
+  bool
+  operator()(const NamePrefix& lhs, const Name& rhs) const
+  {
+    return lhs.name.compare(0, lhs.size, rhs) < 0;
+  }
+};
+
+/** \brief Index of records stored in a RecordContainer, keyed by Name.
+ *  \tparam T record type
+ *
+ *  Several records may be stored under the same Name. The index stores pointers to records,
+ *  which must remove themselves from the index before they are destroyed.
+ */
+template<typename T>
+class NameIndex : noncopyable
+{
+public:
+  using Record = T;
+
+  void
+  insert(const Name& name, const Record& record)
+  {
+    m_index[name].push_back(&record);
+  }
+
+  void
+  erase(const Name& name, const Record& record)
+  {
+    auto it = m_index.find(name);
+    BOOST_ASSERT(it != m_index.end());
+
+    auto& records = it->second;
+    records.erase(std::find(records.begin(), records.end(), &record));
+    if (records.empty()) {
+      m_index.erase(it);
+    }
+  }
+
+  /** \brief Append the IDs of records stored under \p key to \p ids.
+   */
+  void
+  collect(const NamePrefix& key, std::vector<RecordId>& ids) const
+  {
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+      for (const Record* record : it->second) {
+        ids.push_back(record->getId());
+      }
+    }
+  }
+
+  /** \brief Append the IDs of records stored under \p name or any of its prefixes to \p ids.
+   */
+  void
+  collectPrefixesOf(const Name& name, std::vector<RecordId>& ids) const
+  {
+    for (size_t prefixLen = 0; prefixLen <= name.size(); ++prefixLen) {
+      collect({name, prefixLen}, ids);
+    }
+  }
+
+  NDN_CXX_NODISCARD bool
+  empty() const noexcept
+  {
+    return m_index.empty();
+  }
+
+private:
+  std::map<Name, std::vector<const Record*>, NamePrefixCompare> m_index;
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_IMPL_NAME_INDEX_HPP
@@ -25,6 +25,7 @@
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/face.hpp"
 #include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/impl/name-index.hpp"
 #include "ndn-cxx/impl/record-container.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
@@ -52,6 +53,47 @@ operator<<(std::ostream& os, PendingInterestOrigin origin)
   NDN_CXX_UNREACHABLE;
 }
 
+class PendingInterest;
+
+/**
+ * @brief Name index of pending Interests.
+ *
+ * The index finds the pending Interests that may be satisfied by a Data or rejected by a Nack
+ * with a number of lookups proportional to the Name length, instead of visiting every entry.
+ * Interests that cannot be satisfied by Data with a longer Name (CanBePrefix=false) and those
+ * that can (CanBePrefix=true) are indexed separately.
+ */
+class PendingInterestIndex : noncopyable
+{
+public:
+  void
+  insert(const PendingInterest& entry);
+
+  void
+  erase(const PendingInterest& entry);
+
+  /**
+   * @brief Find pending Interests that may be satisfied by @p data
+   * @return IDs of candidate entries in ascending order; the caller must confirm each candidate
+   *         with Interest::matchesData
+   */
+  std::vector<detail::RecordId>
+  findDataCandidates(const Data& data) const;
+
+  /**
+   * @brief Find pending Interests that may be rejected by a Nack of @p interest
+   * @return IDs of candidate entries in ascending order; the caller must confirm each candidate
+   *         with Interest::matchesInterest
+   */
+  std::vector<detail::RecordId>
+  findNackCandidates(const Interest& interest) const;
+
+private:
+  detail::NameIndex<PendingInterest> m_exactIndex;  ///< Interests with CanBePrefix=false
+  detail::NameIndex<PendingInterest> m_prefixIndex; ///< Interests with CanBePrefix=true
+  size_t m_nDigestEntries = 0; ///< number of Interests whose Name ends with an implicit digest
+};
+
 /**
  * @brief Stores a pending Interest and associated callbacks.
  */
@@ -66,24 +108,34 @@ public:
    */
   PendingInterest(shared_ptr<const Interest> interest, const DataCallback& dataCallback,
                   const NackCallback& nackCallback, const TimeoutCallback& timeoutCallback,
-                  Scheduler& scheduler)
+                  Scheduler& scheduler, PendingInterestIndex& index)
     : m_interest(std::move(interest))
     , m_origin(PendingInterestOrigin::APP)
     , m_dataCallback(dataCallback)
     , m_nackCallback(nackCallback)
     , m_timeoutCallback(timeoutCallback)
+    , m_index(index)
   {
     scheduleTimeoutEvent(scheduler);
+    m_index.insert(*this);
   }
 
   /**
    * @brief Construct a pending Interest record for an Interest from the forwarder
    */
-  PendingInterest(shared_ptr<const Interest> interest, Scheduler& scheduler)
+  PendingInterest(shared_ptr<const Interest> interest, Scheduler& scheduler,
+                  PendingInterestIndex& index)
     : m_interest(std::move(interest))
     , m_origin(PendingInterestOrigin::FORWARDER)
+    , m_index(index)
   {
     scheduleTimeoutEvent(scheduler);
+    m_index.insert(*this);
+  }
+
+  ~PendingInterest()
+  {
+    m_index.erase(*this);
   }
 
   shared_ptr<const Interest>
@@ -181,8 +233,63 @@ private:
   scheduler::ScopedEventId m_timeoutEvent;
   int m_nNotNacked = 0; ///< number of Interest destinations that have not Nacked
   optional<lp::Nack> m_leastSevereNack;
+  PendingInterestIndex& m_index;
 };
 
+inline void
+PendingInterestIndex::insert(const PendingInterest& entry)
+{
+  const Interest& interest = *entry.getInterest();
+  auto& index = interest.getCanBePrefix() ? m_prefixIndex : m_exactIndex;
+  index.insert(interest.getName(), entry);
+
+  if (!interest.getName().empty() && interest.getName().get(-1).isImplicitSha256Digest()) {
+    ++m_nDigestEntries;
+  }
+}
+
+inline void
+PendingInterestIndex::erase(const PendingInterest& entry)
+{
+  const Interest& interest = *entry.getInterest();
+  auto& index = interest.getCanBePrefix() ? m_prefixIndex : m_exactIndex;
+  index.erase(interest.getName(), entry);
+
+  if (!interest.getName().empty() && interest.getName().get(-1).isImplicitSha256Digest()) {
+    --m_nDigestEntries;
+  }
+}
+
+inline std::vector<detail::RecordId>
+PendingInterestIndex::findDataCandidates(const Data& data) const
+{
+  std::vector<detail::RecordId> ids;
+  const Name& name = data.getName();
+  m_exactIndex.collect({name, name.size()}, ids);
+  m_prefixIndex.collectPrefixesOf(name, ids);
+
+  // computing the full Name requires a SHA-256 digest, only do it when it can make a difference
+  if (m_nDigestEntries > 0) {
+    const Name& fullName = data.getFullName();
+    m_exactIndex.collect({fullName, fullName.size()}, ids);
+    m_prefixIndex.collect({fullName, fullName.size()}, ids);
+  }
+
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+inline std::vector<detail::RecordId>
+PendingInterestIndex::findNackCandidates(const Interest& interest) const
+{
+  std::vector<detail::RecordId> ids;
+  const Name& name = interest.getName();
+  auto& index = interest.getCanBePrefix() ? m_prefixIndex : m_exactIndex;
+  index.collect({name, name.size()}, ids);
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
 } // namespace ndn
 
 #endif // NDN_IMPL_PENDING_INTEREST_HPP
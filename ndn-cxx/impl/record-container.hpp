@@ -159,6 +159,26 @@ public:
     }
   }
 
+  /** \brief Visit records with the given IDs, with the option to erase.
+   *  \tparam Visitor function of type 'bool f(Record& record)'
+   *  \param ids IDs of records to visit; IDs of records that no longer exist are skipped
+   *  \param f visitor function, return true to erase record
+   */
+  template<typename Visitor>
+  void
+  removeIf(const std::vector<RecordId>& ids, const Visitor& f)
+  {
+    for (RecordId id : ids) {
+      auto i = m_container.find(id);
+      if (i != m_container.end() && f(i->second)) {
+        m_container.erase(i);
+      }
+    }
+    if (empty()) {
+      this->onEmpty();
+    }
+  }
+
   /** \brief Visit all records.
    *  \tparam Visitor function of type 'void f(Record& record)'
    *  \param f visitor function
@@ -173,6 +193,21 @@ public:
     });
   }
 
+  /** \brief Visit records with the given IDs.
+   *  \tparam Visitor function of type 'void f(Record& record)'
+   *  \param ids IDs of records to visit; IDs of records that no longer exist are skipped
+   *  \param f visitor function
+   */
+  template<typename Visitor>
+  void
+  forEach(const std::vector<RecordId>& ids, const Visitor& f)
+  {
+    removeIf(ids, [&f] (Record& record) {
+      f(record);
+      return false;
+    });
+  }
+
   NDN_CXX_NODISCARD bool
   empty() const noexcept
   {
@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_IMPL_WORKER_POOL_HPP
+#define NDN_IMPL_WORKER_POOL_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+#include <thread>
+
+namespace ndn {
+namespace detail {
+
+/** \brief Fixed-size pool of threads that execute posted jobs.
+ *
+ *  Jobs are executed in no particular order by any of the threads. The destructor waits until
+ *  all posted jobs have been executed.
+ */
+class WorkerPool : noncopyable
+{
+public:
+  explicit
+  WorkerPool(size_t nThreads)
+    : m_work(make_unique<boost::asio::io_service::work>(m_io))
+  {
+    BOOST_ASSERT(nThreads > 0);
+    m_threads.reserve(nThreads);
+    for (size_t i = 0; i < nThreads; ++i) {
+      m_threads.emplace_back([this] { m_io.run(); });
+    }
+  }
+
+  ~WorkerPool()
+  {
+    m_work.reset();
+    for (auto& thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  size_t
+  size() const
+  {
+    return m_threads.size();
+  }
+
+  /** \brief Execute \p job on one of the threads; thread-safe.
+   */
+  template<typename Job>
+  void
+  post(Job&& job)
+  {
+    m_io.post(std::forward<Job>(job));
+  }
+
+private:
+  boost::asio::io_service m_io;
+  unique_ptr<boost::asio::io_service::work> m_work;
+  std::vector<std::thread> m_threads;
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_IMPL_WORKER_POOL_HPP
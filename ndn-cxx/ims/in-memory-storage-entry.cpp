@@ -23,29 +23,22 @@
 
 namespace ndn {
 
-InMemoryStorageEntry::InMemoryStorageEntry()
-  : m_isFresh(true)
-{
-}
+InMemoryStorageEntry::InMemoryStorageEntry() = default;
 
 void
 InMemoryStorageEntry::release()
 {
   m_dataPacket.reset();
-  m_markStaleEventId.cancel();
+  m_wireSize = 0;
+  m_staleTime = time::steady_clock::TimePoint::max();
 }
 
 void
 InMemoryStorageEntry::setData(const Data& data)
 {
   m_dataPacket = data.shared_from_this();
-  m_isFresh = true;
-}
-
-void
-InMemoryStorageEntry::scheduleMarkStale(Scheduler& sched, time::nanoseconds after)
-{
-  m_markStaleEventId = sched.schedule(after, [this] { m_isFresh = false; });
+  m_wireSize = data.wireEncode().size();
+  m_staleTime = time::steady_clock::TimePoint::max();
 }
 
 } // namespace ndn
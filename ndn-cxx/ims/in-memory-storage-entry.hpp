@@ -24,7 +24,7 @@
 
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/interest.hpp"
-#include "ndn-cxx/util/scheduler.hpp"
+#include "ndn-cxx/util/time.hpp"
 
 namespace ndn {
 
@@ -52,6 +52,8 @@ public:
 
   /** @brief Returns the full name (including implicit digest) of the Data packet stored
    *         in the in-memory storage entry
+   *
+   *  The implicit digest is computed on first use, unless the Data packet has it cached.
    */
   const Name&
   getFullName() const
@@ -59,6 +61,14 @@ public:
     return m_dataPacket->getFullName();
   }
 
+  /** @brief Returns whether the implicit digest of the Data packet has been computed
+   */
+  bool
+  hasFullName() const
+  {
+    return m_dataPacket->hasFullName();
+  }
+
   /** @brief Returns the Data packet stored in the in-memory storage entry
    */
   const Data&
@@ -67,6 +77,14 @@ public:
     return *m_dataPacket;
   }
 
+  /** @brief Returns the size of the wire encoding of the Data packet, as of setData()
+   */
+  size_t
+  getWireSize() const
+  {
+    return m_wireSize;
+  }
+
   /** @brief Changes the content of in-memory storage entry
    *
    *  This method also allows data to satisfy Interest with MustBeFresh
@@ -74,24 +92,36 @@ public:
   void
   setData(const Data& data);
 
-  /** @brief Schedule an event to mark this entry as non-fresh.
+  /** @brief Mark this entry as non-fresh from @p staleTime onwards.
+   *
+   *  Staleness is evaluated when isFresh() is called, so no timer is associated with the entry.
    */
   void
-  scheduleMarkStale(Scheduler& sched, time::nanoseconds after);
+  markStaleAt(time::steady_clock::TimePoint staleTime)
+  {
+    m_staleTime = staleTime;
+  }
 
   /** @brief Check if the data can satisfy an interest with MustBeFresh
    */
   bool
-  isFresh()
+  isFresh() const
   {
-    return m_isFresh;
+    return isFresh(time::steady_clock::now());
+  }
+
+  /** @brief Check if the data can satisfy an interest with MustBeFresh at time @p now
+   */
+  bool
+  isFresh(time::steady_clock::TimePoint now) const
+  {
+    return now < m_staleTime;
   }
 
 private:
   shared_ptr<const Data> m_dataPacket;
-
-  bool m_isFresh;
-  scheduler::ScopedEventId m_markStaleEventId;
+  size_t m_wireSize = 0;
+  time::steady_clock::TimePoint m_staleTime = time::steady_clock::TimePoint::max();
 };
 
 } // namespace ndn
@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-file.hpp"
+#include "ndn-cxx/encoding/tlv.hpp"
+
+#include <boost/filesystem/operations.hpp>
+
+#include <cstdio>
+
+namespace ndn {
+
+InMemoryStorageFile::InMemoryStorageFile(const std::string& path)
+  : m_path(path)
+{
+  load();
+  openLog();
+}
+
+InMemoryStorageFile::InMemoryStorageFile(boost::asio::io_service& ioService, const std::string& path)
+  : InMemoryStoragePersistent(ioService)
+  , m_path(path)
+{
+  load();
+  openLog();
+}
+
+void
+InMemoryStorageFile::load()
+{
+  boost::system::error_code ec;
+  auto status = boost::filesystem::status(m_path, ec);
+  if (status.type() == boost::filesystem::file_not_found) {
+    // the log does not exist yet
+    return;
+  }
+  if (status.type() != boost::filesystem::regular_file) {
+    NDN_THROW(Error(m_path + " is not a regular file"));
+  }
+
+  auto fileSize = boost::filesystem::file_size(m_path, ec);
+  if (ec) {
+    NDN_THROW(Error("Cannot read " + m_path + ": " + ec.message()));
+  }
+
+  auto buffer = make_shared<Buffer>(static_cast<size_t>(fileSize));
+  std::ifstream is(m_path, std::ios::binary);
+  is.read(reinterpret_cast<char*>(buffer->data()), static_cast<std::streamsize>(buffer->size()));
+  if (!is) {
+    NDN_THROW(Error("Cannot read " + m_path));
+  }
+  is.close();
+
+  std::vector<tlv::ElementIndexEntry> records;
+  size_t validSize = tlv::indexElements(buffer->data(), buffer->size(), std::back_inserter(records));
+
+  m_isLoading = true;
+  for (const auto& record : records) {
+    // every recovered Block shares the log buffer
+    Block block(buffer, record.type,
+                buffer->begin() + record.begin, buffer->begin() + record.end,
+                buffer->begin() + record.valueBegin, buffer->begin() + record.end);
+    try {
+      if (record.type == tlv::Data) {
+        insert(*make_shared<Data>(block));
+        continue;
+      }
+      if (record.type == tlv::Name) {
+        erase(Name(block), false);
+        continue;
+      }
+    }
+    catch (const tlv::Error&) {
+    }
+    // the rest of the log cannot be trusted
+    validSize = record.begin;
+    break;
+  }
+  m_isLoading = false;
+
+  if (validSize < buffer->size()) {
+    boost::filesystem::resize_file(m_path, validSize, ec);
+    if (ec) {
+      NDN_THROW(Error("Cannot truncate " + m_path + ": " + ec.message()));
+    }
+  }
+}
+
+void
+InMemoryStorageFile::openLog()
+{
+  m_log.open(m_path, std::ios::binary | std::ios::app);
+  if (!m_log) {
+    NDN_THROW(Error("Cannot open " + m_path));
+  }
+}
+
+void
+InMemoryStorageFile::append(const Block& record)
+{
+  m_log.write(reinterpret_cast<const char*>(record.wire()), static_cast<std::streamsize>(record.size()));
+  m_log.flush();
+  if (!m_log) {
+    NDN_THROW(Error("Cannot write to " + m_path));
+  }
+}
+
+void
+InMemoryStorageFile::afterInsert(InMemoryStorageEntry* entry)
+{
+  if (!m_isLoading) {
+    append(entry->getData().wireEncode());
+  }
+}
+
+void
+InMemoryStorageFile::beforeErase(InMemoryStorageEntry* entry)
+{
+  if (!m_isLoading) {
+    append(entry->getFullName().wireEncode());
+  }
+}
+
+void
+InMemoryStorageFile::compact()
+{
+  std::string tmpPath = m_path + ".tmp";
+  {
+    std::ofstream os(tmpPath, std::ios::binary | std::ios::trunc);
+    for (const Data& data : *this) {
+      const Block& wire = data.wireEncode();
+      os.write(reinterpret_cast<const char*>(wire.wire()), static_cast<std::streamsize>(wire.size()));
+    }
+    os.flush();
+    if (!os) {
+      NDN_THROW(Error("Cannot write " + tmpPath));
+    }
+  }
+
+  m_log.close();
+  bool isRenamed = std::rename(tmpPath.data(), m_path.data()) == 0;
+  openLog();
+  if (!isRenamed) {
+    NDN_THROW(Error("Cannot replace " + m_path));
+  }
+}
+
+} // namespace ndn
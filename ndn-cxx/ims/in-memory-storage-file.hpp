@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_IMS_IN_MEMORY_STORAGE_FILE_HPP
+#define NDN_IMS_IN_MEMORY_STORAGE_FILE_HPP
+
+#include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+
+#include <fstream>
+
+namespace ndn {
+
+/** @brief Provides persistent application cache that survives restarts
+ *
+ *  Like InMemoryStoragePersistent, no replacement policy is employed. In addition, the wire
+ *  encoding of every inserted packet is appended to a log file, and the Name with implicit digest
+ *  of every packet removed with erase() is appended as a tombstone. When the storage is created,
+ *  the log is read into a single buffer and replayed; recovered packets are decoded in place, so
+ *  their wire encodings refer to that buffer and are neither copied nor signed again.
+ *
+ *  An incomplete or malformed record at the end of the log, such as one left by a crash during
+ *  an append, is discarded. Recovered packets are inserted without a MustBeFresh processing
+ *  window. Records are written to the operating system after each append, but the file is not
+ *  synchronized to disk.
+ */
+class InMemoryStorageFile : public InMemoryStoragePersistent
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /** @brief Open or create the log file at @p path, and load the packets it contains
+   *  @throw Error the log file cannot be read or written
+   */
+  explicit
+  InMemoryStorageFile(const std::string& path);
+
+  /** @brief Open or create the log file at @p path, and load the packets it contains
+   *
+   *  The InMemoryStorage created through this method will handle MustBeFresh in interest processing
+   *
+   *  @throw Error the log file cannot be read or written
+   */
+  InMemoryStorageFile(boost::asio::io_service& ioService, const std::string& path);
+
+  /** @brief Rewrite the log file so that it contains only the packets currently stored
+   *
+   *  Tombstones and the records of erased packets are dropped.
+   *
+   *  @throw Error the log file cannot be written
+   */
+  void
+  compact();
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
+  /** @brief Appends the wire encoding of the inserted packet to the log
+   */
+  void
+  afterInsert(InMemoryStorageEntry* entry) override;
+
+  /** @brief Appends a tombstone for the erased packet to the log
+   */
+  void
+  beforeErase(InMemoryStorageEntry* entry) override;
+
+private:
+  void
+  load();
+
+  void
+  openLog();
+
+  void
+  append(const Block& record);
+
+private:
+  std::string m_path;
+  std::ofstream m_log;
+  bool m_isLoading = false;
+};
+
+} // namespace ndn
+
+#endif // NDN_IMS_IN_MEMORY_STORAGE_FILE_HPP
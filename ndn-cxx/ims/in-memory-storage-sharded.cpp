@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+
+namespace ndn {
+
+InMemoryStorageSharded::InMemoryStorageSharded(size_t nShards, const ShardFactory& makeShard)
+  : m_shards(nShards)
+{
+  BOOST_ASSERT(nShards > 0);
+  for (auto& shard : m_shards) {
+    shard.storage = makeShard();
+  }
+}
+
+void
+InMemoryStorageSharded::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
+{
+  auto& shard = m_shards[getShardIndex(data.getName())];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.storage->insert(data, mustBeFreshProcessingWindow);
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Interest& interest)
+{
+  if (interest.getCanBePrefix()) {
+    return findInAllShards([&interest] (const InMemoryStorage& storage) { return storage.peek(interest); },
+                           [&interest] (InMemoryStorage& storage) { return storage.find(interest); });
+  }
+
+  const Name& name = interest.getName();
+
+  // the Interest Name may be the full name of a Data, which is stored in the shard of its Name
+  if (!name.empty() && name[-1].isImplicitSha256Digest()) {
+    auto& shard = m_shards[getShardIndex(name.getPrefix(-1))];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto data = shard.storage->find(interest);
+    if (data != nullptr) {
+      return data;
+    }
+  }
+
+  auto& shard = m_shards[getShardIndex(name)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.storage->find(interest);
+}
+
+shared_ptr<const Data>
+InMemoryStorageSharded::find(const Name& name)
+{
+  return findInAllShards([&name] (const InMemoryStorage& storage) { return storage.peek(name); },
+                         [&name] (InMemoryStorage& storage) { return storage.find(name); });
+}
+
+template<typename Peek, typename Find>
+shared_ptr<const Data>
+InMemoryStorageSharded::findInAllShards(const Peek& peek, const Find& find)
+{
+  // select the shard without side effects, so that only the replacement policy of the shard
+  // whose Data is returned sees the access
+  Shard* bestShard = nullptr;
+  shared_ptr<const Data> best;
+  for (auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto data = peek(*shard.storage);
+    if (data != nullptr && (best == nullptr || data->getName() < best->getName())) {
+      bestShard = &shard;
+      best = std::move(data);
+    }
+  }
+
+  if (bestShard == nullptr) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(bestShard->mutex);
+  return find(*bestShard->storage);
+}
+
+void
+InMemoryStorageSharded::erase(const Name& prefix, bool isPrefix)
+{
+  for (auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.storage->erase(prefix, isPrefix);
+  }
+}
+
+size_t
+InMemoryStorageSharded::size() const
+{
+  size_t n = 0;
+  for (const auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    n += shard.storage->size();
+  }
+  return n;
+}
+
+} // namespace ndn
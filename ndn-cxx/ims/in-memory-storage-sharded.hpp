@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+#define NDN_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
+
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+
+#include <mutex>
+
+namespace ndn {
+
+/** @brief Provides application cache partitioned into shards that can be used concurrently
+ *
+ *  Each Data packet is stored in the shard selected by the hash of its Name, and each shard is
+ *  an InMemoryStorage protected by its own mutex. Lookups of Interests without CanBePrefix and
+ *  insertions only lock the one shard that can hold the packet, so they can proceed in parallel
+ *  from multiple threads. Prefix lookups and erasures visit every shard in turn; a prefix lookup
+ *  accesses only the shard whose Data it returns, as far as the replacement policy is concerned.
+ *
+ *  The replacement policy, limits, and MustBeFresh handling of each shard are determined by the
+ *  InMemoryStorage returned from the shard factory. A packet or Interest passed to this class
+ *  must not be modified by other threads for the duration of the call.
+ */
+class InMemoryStorageSharded : noncopyable
+{
+public:
+  using ShardFactory = std::function<unique_ptr<InMemoryStorage>()>;
+
+  /** @brief Create a sharded storage of @p nShards shards, each created by @p makeShard
+   *  @pre nShards > 0
+   */
+  InMemoryStorageSharded(size_t nShards, const ShardFactory& makeShard);
+
+  /** @brief Inserts a Data packet into the shard of its Name
+   *  @sa InMemoryStorage::insert
+   */
+  void
+  insert(const Data& data,
+         const time::milliseconds& mustBeFreshProcessingWindow = InMemoryStorage::INFINITE_WINDOW);
+
+  /** @brief Finds the best match Data for an Interest
+   *
+   *  If the Interest has CanBePrefix, every shard is searched, and the match with the smallest
+   *  Name is returned, as InMemoryStorage::find(const Interest&) would.
+   */
+  shared_ptr<const Data>
+  find(const Interest& interest);
+
+  /** @brief Finds a Data whose full name starts with @p name, searching every shard
+   *  @sa InMemoryStorage::find(const Name&)
+   */
+  shared_ptr<const Data>
+  find(const Name& name);
+
+  /** @brief Deletes entries from every shard
+   *  @sa InMemoryStorage::erase
+   */
+  void
+  erase(const Name& prefix, bool isPrefix = true);
+
+  /** @return{ number of packets stored in all shards }
+   */
+  size_t
+  size() const;
+
+  size_t
+  getNShards() const
+  {
+    return m_shards.size();
+  }
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** @brief Returns the index of the shard that stores Data named @p dataName
+   */
+  size_t
+  getShardIndex(const Name& dataName) const
+  {
+    return dataName.getHash() % m_shards.size();
+  }
+
+private:
+  struct Shard
+  {
+    mutable std::mutex mutex;
+    unique_ptr<InMemoryStorage> storage;
+  };
+
+  /** @brief Selects the shard whose match is returned with @p peek, then invokes @p find on it
+   */
+  template<typename Peek, typename Find>
+  shared_ptr<const Data>
+  findInAllShards(const Peek& peek, const Find& find);
+
+private:
+  std::vector<Shard> m_shards;
+};
+
+} // namespace ndn
+
+#endif // NDN_IMS_IN_MEMORY_STORAGE_SHARDED_HPP
@@ -0,0 +1,252 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-tinylfu.hpp"
+
+namespace ndn {
+
+// share of the cache used as the admission window, in percent
+static const size_t WINDOW_PERCENT = 1;
+// share of the main cache used as the protected segment, in percent
+static const size_t PROTECTED_PERCENT = 80;
+// number of counters per row of the sketch, for each entry the cache is sized for
+static const size_t SKETCH_WIDTH_FACTOR = 4;
+// the sketch is halved after this many increments, for each entry the cache is sized for
+static const size_t SAMPLE_FACTOR = 10;
+
+constexpr size_t InMemoryStorageTinyLfu::FrequencySketch::DEPTH;
+constexpr uint8_t InMemoryStorageTinyLfu::FrequencySketch::MAX_COUNT;
+
+void
+InMemoryStorageTinyLfu::FrequencySketch::ensureCapacity(size_t nEntries)
+{
+  size_t width = 64;
+  while (width < nEntries * SKETCH_WIDTH_FACTOR) {
+    width <<= 1;
+  }
+  if (width <= m_width) {
+    return;
+  }
+
+  m_width = width;
+  m_sampleSize = width / SKETCH_WIDTH_FACTOR * SAMPLE_FACTOR;
+  m_counters.assign(DEPTH * m_width, 0);
+  m_nIncrements = 0;
+}
+
+size_t
+InMemoryStorageTinyLfu::FrequencySketch::indexOf(size_t hash, size_t row) const
+{
+  static const uint64_t SEEDS[DEPTH] = {
+    0xc3a5c85c97cb3127, 0xb492b66fbe98f273, 0x9ae16a3b2f90404f, 0xcbf29ce484222325,
+  };
+
+  uint64_t h = (static_cast<uint64_t>(hash) + SEEDS[row]) * SEEDS[row];
+  h ^= h >> 32;
+  return row * m_width + static_cast<size_t>(h & (m_width - 1));
+}
+
+void
+InMemoryStorageTinyLfu::FrequencySketch::increment(size_t hash)
+{
+  BOOST_ASSERT(m_width > 0);
+
+  bool isIncremented = false;
+  for (size_t row = 0; row < DEPTH; ++row) {
+    uint8_t& counter = m_counters[indexOf(hash, row)];
+    if (counter < MAX_COUNT) {
+      ++counter;
+      isIncremented = true;
+    }
+  }
+
+  // periodically halve all counters, so that past popularity fades
+  if (isIncremented && ++m_nIncrements >= m_sampleSize) {
+    for (auto& counter : m_counters) {
+      counter >>= 1;
+    }
+    m_nIncrements /= 2;
+  }
+}
+
+uint8_t
+InMemoryStorageTinyLfu::FrequencySketch::estimate(size_t hash) const
+{
+  if (m_width == 0) {
+    return 0;
+  }
+
+  uint8_t frequency = MAX_COUNT;
+  for (size_t row = 0; row < DEPTH; ++row) {
+    frequency = std::min(frequency, m_counters[indexOf(hash, row)]);
+  }
+  return frequency;
+}
+
+InMemoryStorageTinyLfu::InMemoryStorageTinyLfu(size_t limit)
+  : InMemoryStorage(limit)
+{
+}
+
+InMemoryStorageTinyLfu::InMemoryStorageTinyLfu(boost::asio::io_service& ioService, size_t limit)
+  : InMemoryStorage(ioService, limit)
+{
+}
+
+size_t
+InMemoryStorageTinyLfu::getNominalSize() const
+{
+  size_t nominalSize = getLimit() != std::numeric_limits<size_t>::max() ? getLimit() : size();
+  return std::max<size_t>(nominalSize, 1);
+}
+
+size_t
+InMemoryStorageTinyLfu::getWindowLimit() const
+{
+  return std::max<size_t>(getNominalSize() * WINDOW_PERCENT / 100, 1);
+}
+
+size_t
+InMemoryStorageTinyLfu::getProtectedLimit() const
+{
+  size_t mainSize = getNominalSize() - std::min(getNominalSize(), getWindowLimit());
+  return std::max<size_t>(mainSize * PROTECTED_PERCENT / 100, 1);
+}
+
+InMemoryStorageEntry*
+InMemoryStorageTinyLfu::selectMainVictim() const
+{
+  if (!m_probation.empty()) {
+    return m_probation.get<byUsedTime>().front();
+  }
+  if (!m_protected.empty()) {
+    return m_protected.get<byUsedTime>().front();
+  }
+  return nullptr;
+}
+
+void
+InMemoryStorageTinyLfu::afterInsert(InMemoryStorageEntry* entry)
+{
+  m_sketch.ensureCapacity(getNominalSize());
+  m_sketch.increment(entry->getName().getHash());
+  m_window.get<byUsedTime>().push_back(entry);
+
+  // packets overflowing the window enter the probation segment
+  size_t windowLimit = getWindowLimit();
+  while (m_window.size() > windowLimit) {
+    m_probation.get<byUsedTime>().push_back(m_window.get<byUsedTime>().front());
+    m_window.get<byUsedTime>().pop_front();
+  }
+}
+
+bool
+InMemoryStorageTinyLfu::evictItem()
+{
+  InMemoryStorageEntry* candidate = m_window.empty() ? nullptr : m_window.get<byUsedTime>().front();
+  InMemoryStorageEntry* victim = selectMainVictim();
+  if (candidate == nullptr && victim == nullptr) {
+    return false;
+  }
+
+  // The packet about to be inserted will push the least recently used packet out of a full
+  // window. That candidate is admitted into the main cache only if it is estimated to be more
+  // popular than the victim of the main cache; otherwise the candidate itself is evicted.
+  if (candidate != nullptr && (victim == nullptr || m_window.size() >= getWindowLimit())) {
+    m_window.get<byUsedTime>().pop_front();
+    if (victim == nullptr ||
+        m_sketch.estimate(candidate->getName().getHash()) <=
+        m_sketch.estimate(victim->getName().getHash())) {
+      eraseImpl(candidate);
+      return true;
+    }
+    m_probation.get<byUsedTime>().push_back(candidate);
+  }
+
+  beforeErase(victim);
+  eraseImpl(victim);
+  return true;
+}
+
+void
+InMemoryStorageTinyLfu::beforeErase(InMemoryStorageEntry* entry)
+{
+  for (CleanupIndex* segment : {&m_window, &m_probation, &m_protected}) {
+    auto it = segment->get<byEntity>().find(entry);
+    if (it != segment->get<byEntity>().end()) {
+      segment->get<byEntity>().erase(it);
+      return;
+    }
+  }
+}
+
+void
+InMemoryStorageTinyLfu::afterAccess(InMemoryStorageEntry* entry)
+{
+  m_sketch.increment(entry->getName().getHash());
+
+  // within the window and the protected segment, move the entry to the most recently used end
+  for (CleanupIndex* segment : {&m_window, &m_protected}) {
+    auto it = segment->get<byEntity>().find(entry);
+    if (it != segment->get<byEntity>().end()) {
+      auto& byTime = segment->get<byUsedTime>();
+      byTime.relocate(byTime.end(), segment->project<byUsedTime>(it));
+      return;
+    }
+  }
+
+  // an entry accessed while on probation is promoted to the protected segment,
+  // whose least recently used entries are demoted back to probation
+  auto it = m_probation.get<byEntity>().find(entry);
+  if (it == m_probation.get<byEntity>().end()) {
+    return;
+  }
+  m_probation.get<byEntity>().erase(it);
+  m_protected.get<byUsedTime>().push_back(entry);
+
+  size_t protectedLimit = getProtectedLimit();
+  while (m_protected.size() > protectedLimit) {
+    m_probation.get<byUsedTime>().push_back(m_protected.get<byUsedTime>().front());
+    m_protected.get<byUsedTime>().pop_front();
+  }
+}
+
+InMemoryStorageTinyLfu::Segment
+InMemoryStorageTinyLfu::getSegment(const Name& name) const
+{
+  auto contains = [&name] (const CleanupIndex& segment) {
+    return std::any_of(segment.begin(), segment.end(),
+                       [&name] (const InMemoryStorageEntry* entry) { return entry->getName() == name; });
+  };
+
+  if (contains(m_window)) {
+    return Segment::WINDOW;
+  }
+  if (contains(m_probation)) {
+    return Segment::PROBATION;
+  }
+  if (contains(m_protected)) {
+    return Segment::PROTECTED;
+  }
+  return Segment::NONE;
+}
+
+} // namespace ndn
@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_IMS_IN_MEMORY_STORAGE_TINYLFU_HPP
+#define NDN_IMS_IN_MEMORY_STORAGE_TINYLFU_HPP
+
+#include "ndn-cxx/ims/in-memory-storage.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/identity.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+namespace ndn {
+
+/** @brief Provides in-memory storage employing the W-TinyLFU replacement policy.
+ *
+ *  Newly inserted packets enter a small LRU window. A packet leaving the window is admitted into
+ *  the main cache only if it has been requested more often than the packet the main cache would
+ *  evict for it; the main cache is a segmented LRU made of a probation and a protected segment.
+ *  Access frequencies are estimated by a count-min sketch keyed by Data name, which also
+ *  remembers packets that are no longer stored and is periodically halved, so that the policy
+ *  resists scans and adapts to shifts in popularity. Every operation takes constant time.
+ *
+ *  @sa Gil Einziger, Roy Friedman, Ben Manes, "TinyLFU: A Highly Efficient Cache Admission
+ *      Policy," ACM Transactions on Storage, 2017.
+ */
+class InMemoryStorageTinyLfu : public InMemoryStorage
+{
+public:
+  explicit
+  InMemoryStorageTinyLfu(size_t limit = 16);
+
+  explicit
+  InMemoryStorageTinyLfu(boost::asio::io_service& ioService, size_t limit = 16);
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
+  /** @brief Removes one Data packet from in-memory storage based on W-TinyLFU, i.e. evict either
+   *  the least recently used packet of the window or the victim of the main cache, whichever has
+   *  the lower estimated frequency
+   *  @return{ whether the Data was removed }
+   */
+  bool
+  evictItem() override;
+
+  /** @brief Update the entry when the entry is returned by the find() function,
+   *  record the access and promote the entry within its segment
+   */
+  void
+  afterAccess(InMemoryStorageEntry* entry) override;
+
+  /** @brief Update the entry after a entry is successfully inserted, add it to the window
+   */
+  void
+  afterInsert(InMemoryStorageEntry* entry) override;
+
+  /** @brief Update the entry or other data structures before a entry is successfully erased,
+   *  erase it from its segment
+   */
+  void
+  beforeErase(InMemoryStorageEntry* entry) override;
+
+NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** @brief Count-min sketch of access frequencies with 4-bit counters
+   */
+  class FrequencySketch
+  {
+  public:
+    /** @brief Resize the sketch to track about @p nEntries entries, if it is smaller
+     *
+     *  Resizing discards the recorded frequencies.
+     */
+    void
+    ensureCapacity(size_t nEntries);
+
+    void
+    increment(size_t hash);
+
+    uint8_t
+    estimate(size_t hash) const;
+
+  private:
+    size_t
+    indexOf(size_t hash, size_t row) const;
+
+  public:
+    static constexpr size_t DEPTH = 4;
+    static constexpr uint8_t MAX_COUNT = 15;
+
+  private:
+    std::vector<uint8_t> m_counters; // DEPTH rows of m_width counters
+    size_t m_width = 0;
+    size_t m_sampleSize = 0;
+    size_t m_nIncrements = 0;
+  };
+
+  enum class Segment {
+    NONE,
+    WINDOW,
+    PROBATION,
+    PROTECTED,
+  };
+
+  /** @brief Returns the segment holding the packet named @p name, in linear time
+   */
+  Segment
+  getSegment(const Name& name) const;
+
+private:
+  // multi_index_container to implement an LRU segment
+  class byUsedTime;
+  class byEntity;
+
+  typedef boost::multi_index_container<
+    InMemoryStorageEntry*,
+    boost::multi_index::indexed_by<
+
+      // by Entry itself
+      boost::multi_index::hashed_unique<
+        boost::multi_index::tag<byEntity>,
+        boost::multi_index::identity<InMemoryStorageEntry*>
+      >,
+
+      // by last used time (LRU)
+      boost::multi_index::sequenced<
+        boost::multi_index::tag<byUsedTime>
+      >
+
+    >
+  > CleanupIndex;
+
+  /** @brief Number of packets the cache is sized for, used to size the segments
+   */
+  size_t
+  getNominalSize() const;
+
+  size_t
+  getWindowLimit() const;
+
+  size_t
+  getProtectedLimit() const;
+
+  /** @brief Returns the least recently used entry in the main cache, or nullptr if it is empty
+   */
+  InMemoryStorageEntry*
+  selectMainVictim() const;
+
+private:
+  FrequencySketch m_sketch;
+  CleanupIndex m_window;
+  CleanupIndex m_probation;
+  CleanupIndex m_protected;
+};
+
+} // namespace ndn
+
+#endif // NDN_IMS_IN_MEMORY_STORAGE_TINYLFU_HPP
@@ -28,7 +28,7 @@ const time::milliseconds InMemoryStorage::INFINITE_WINDOW(-1);
 const time::milliseconds InMemoryStorage::ZERO_WINDOW(0);
 
 InMemoryStorage::const_iterator::const_iterator(const Data* ptr, const Cache* cache,
-                                                Cache::index<byFullName>::type::iterator it)
+                                                Cache::index<byName>::type::iterator it)
   : m_ptr(ptr)
   , m_cache(cache)
   , m_it(it)
@@ -39,7 +39,7 @@ InMemoryStorage::const_iterator&
 InMemoryStorage::const_iterator::operator++()
 {
   m_it++;
-  if (m_it != m_cache->get<byFullName>().end()) {
+  if (m_it != m_cache->get<byName>().end()) {
     m_ptr = &((*m_it)->getData());
   }
   else {
@@ -88,11 +88,11 @@ InMemoryStorage::InMemoryStorage(size_t limit)
   init();
 }
 
-InMemoryStorage::InMemoryStorage(boost::asio::io_service& ioService, size_t limit)
+InMemoryStorage::InMemoryStorage(boost::asio::io_service&, size_t limit)
   : m_limit(limit)
   , m_nPackets(0)
+  , m_isFreshnessTracked(true)
 {
-  m_scheduler = make_unique<Scheduler>(ioService);
   init();
 }
 
@@ -157,12 +157,54 @@ InMemoryStorage::setCapacity(size_t capacity)
   BOOST_ASSERT(size() + m_freeEntries.size() == m_capacity);
 }
 
+size_t
+InMemoryStorage::getEntryOverhead()
+{
+  // the entry, the Data object with its shared_ptr control block (two pointers),
+  // a node of about four pointers in each of the name index and the policy index,
+  // and a node of two pointers plus a bucket in the exact-name index
+  return sizeof(InMemoryStorageEntry) + sizeof(Data) + 2 * sizeof(void*) + 2 * 4 * sizeof(void*) +
+         3 * sizeof(void*);
+}
+
+void
+InMemoryStorage::setByteLimit(size_t nMaxBytes)
+{
+  m_byteLimit = nMaxBytes;
+  if (!evictBytes(0)) {
+    NDN_THROW(Error());
+  }
+}
+
+bool
+InMemoryStorage::evictBytes(size_t nBytes)
+{
+  if (nBytes > m_byteLimit) {
+    return false;
+  }
+
+  while (m_nBytes > m_byteLimit - nBytes) {
+    if (!evictItem()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void
 InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow)
 {
-  // check if identical Data/Name already exists
-  auto it = m_cache.get<byFullName>().find(data.getFullName());
-  if (it != m_cache.get<byFullName>().end())
+  // check if identical Data already exists; packets with the same Name are compared by their
+  // wire encoding, so that the implicit digest does not need to be computed
+  auto range = m_cache.get<byExactName>().equal_range(data.getName());
+  for (auto it = range.first; it != range.second; ++it) {
+    if ((*it)->getData().wireEncode() == data.wireEncode())
+      return;
+  }
+
+  // if the packet would exceed the byte limit, employ replacement policy to make room
+  size_t nBytes = data.wireEncode().size() + getEntryOverhead();
+  if (m_byteLimit != std::numeric_limits<size_t>::max() && !evictBytes(nBytes))
     return;
 
   //if full, double the capacity
@@ -185,8 +227,9 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
   m_freeEntries.pop();
   m_nPackets++;
   entry->setData(data);
-  if (m_scheduler != nullptr && mustBeFreshProcessingWindow > ZERO_WINDOW) {
-    entry->scheduleMarkStale(*m_scheduler, mustBeFreshProcessingWindow);
+  m_nBytes += entry->getWireSize() + getEntryOverhead();
+  if (m_isFreshnessTracked && mustBeFreshProcessingWindow > ZERO_WINDOW) {
+    entry->markStaleAt(time::steady_clock::now() + mustBeFreshProcessingWindow);
   }
   m_cache.insert(entry);
 
@@ -197,110 +240,150 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
 shared_ptr<const Data>
 InMemoryStorage::find(const Name& name)
 {
-  auto it = m_cache.get<byFullName>().lower_bound(name);
-
-  // if not found, return null
-  if (it == m_cache.get<byFullName>().end()) {
+  InMemoryStorageEntry* entry = findEntry(name);
+  if (entry == nullptr) {
     return nullptr;
   }
 
-  // if the given name is not the prefix of the lower_bound, return null
-  if (!name.isPrefixOf((*it)->getFullName())) {
+  afterAccess(entry);
+  return entry->getData().shared_from_this();
+}
+
+shared_ptr<const Data>
+InMemoryStorage::find(const Interest& interest)
+{
+  InMemoryStorageEntry* entry = findEntry(interest);
+  if (entry == nullptr) {
     return nullptr;
   }
 
-  afterAccess(*it);
-  return ((*it)->getData()).shared_from_this();
+  // a packet located by its full name, which is one component longer than its Name,
+  // is returned without notifying the derived class
+  if (entry->getName().size() >= interest.getName().size()) {
+    afterAccess(entry);
+  }
+  return entry->getData().shared_from_this();
 }
 
 shared_ptr<const Data>
-InMemoryStorage::find(const Interest& interest)
+InMemoryStorage::peek(const Name& name) const
 {
-  // if the interest contains implicit digest, it is possible to directly locate a packet.
-  auto it = m_cache.get<byFullName>().find(interest.getName());
+  InMemoryStorageEntry* entry = findEntry(name);
+  return entry == nullptr ? nullptr : entry->getData().shared_from_this();
+}
 
-  // if a packet is located by its full name, it must be the packet to return.
-  if (it != m_cache.get<byFullName>().end()) {
-    return ((*it)->getData()).shared_from_this();
+shared_ptr<const Data>
+InMemoryStorage::peek(const Interest& interest) const
+{
+  InMemoryStorageEntry* entry = findEntry(interest);
+  return entry == nullptr ? nullptr : entry->getData().shared_from_this();
+}
+
+InMemoryStorageEntry*
+InMemoryStorage::findEntry(const Name& name) const
+{
+  // if the name contains implicit digest, it may be the full name of a packet
+  if (!name.empty() && name[-1].isImplicitSha256Digest()) {
+    auto it = findFullName(name);
+    if (it != m_cache.end()) {
+      return *it;
+    }
   }
 
-  // if the packet is not discovered by last step, either the packet is not in the storage or
-  // the interest doesn't contains implicit digest.
-  it = m_cache.get<byFullName>().lower_bound(interest.getName());
+  auto it = m_cache.get<byName>().lower_bound(name);
 
-  if (it == m_cache.get<byFullName>().end()) {
+  // if not found, return null
+  if (it == m_cache.get<byName>().end()) {
     return nullptr;
   }
 
-  // to locate the element that has a just smaller name than the interest's
-  if (it != m_cache.get<byFullName>().begin()) {
-    it--;
-  }
-
-  InMemoryStorageEntry* ret = selectChild(interest, it);
-  if (ret == nullptr) {
+  // if the given name is not the prefix of the lower_bound, return null
+  if (!name.isPrefixOf((*it)->getName())) {
     return nullptr;
   }
 
-  // let derived class do something with the entry
-  afterAccess(ret);
-  return ret->getData().shared_from_this();
+  return *it;
 }
 
-InMemoryStorage::Cache::index<InMemoryStorage::byFullName>::type::iterator
-InMemoryStorage::findNextFresh(Cache::index<byFullName>::type::iterator it) const
+InMemoryStorageEntry*
+InMemoryStorage::findEntry(const Interest& interest) const
 {
-  for (; it != m_cache.get<byFullName>().end(); it++) {
-    if ((*it)->isFresh())
-      return it;
+  const Name& name = interest.getName();
+
+  // if the interest contains implicit digest, it is possible to directly locate a packet.
+  if (!name.empty() && name[-1].isImplicitSha256Digest()) {
+    auto it = findFullName(name);
+
+    // if a packet is located by its full name, it must be the packet to return.
+    if (it != m_cache.end()) {
+      return *it;
+    }
+  }
+
+  // without CanBePrefix, only Data with exactly the Interest Name can match
+  if (!interest.getCanBePrefix()) {
+    return selectExact(interest);
   }
 
-  return it;
+  // if the packet is not discovered by last step, either the packet is not in the storage or
+  // the interest doesn't contains implicit digest.
+  return selectChild(interest, m_cache.get<byName>().lower_bound(name));
 }
 
-InMemoryStorageEntry*
-InMemoryStorage::selectChild(const Interest& interest,
-                             Cache::index<byFullName>::type::iterator startingPoint) const
+InMemoryStorage::Cache::iterator
+InMemoryStorage::findFullName(const Name& fullName) const
 {
-  BOOST_ASSERT(startingPoint != m_cache.get<byFullName>().end());
-
-  if (startingPoint != m_cache.get<byFullName>().begin()) {
-    BOOST_ASSERT((*startingPoint)->getFullName() < interest.getName());
-  }
+  BOOST_ASSERT(!fullName.empty() && fullName[-1].isImplicitSha256Digest());
 
-  // filter out non-fresh data
-  if (interest.getMustBeFresh()) {
-    startingPoint = findNextFresh(startingPoint);
+  auto range = m_cache.get<byExactName>().equal_range(fullName.getPrefix(-1));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (!(*it)->hasFullName()) {
+      ++m_nDigestComputations;
+    }
+    if ((*it)->getFullName() == fullName) {
+      return m_cache.project<byName>(it);
+    }
   }
+  return m_cache.end();
+}
 
-  if (startingPoint == m_cache.get<byFullName>().end()) {
+InMemoryStorageEntry*
+InMemoryStorage::selectExact(const Interest& interest) const
+{
+  auto now = time::steady_clock::now();
+  auto matches = [&] (const InMemoryStorageEntry* entry) {
+    return (!interest.getMustBeFresh() || entry->isFresh(now)) &&
+           interest.matchesData(entry->getData());
+  };
+
+  auto range = m_cache.get<byExactName>().equal_range(interest.getName());
+  auto it = std::find_if(range.first, range.second, matches);
+  if (it == range.second) {
     return nullptr;
   }
-
-  if (interest.matchesData((*startingPoint)->getData())) {
-    return *startingPoint;
+  if (std::find_if(std::next(it), range.second, matches) == range.second) {
+    return *it;
   }
 
-  // iterate to the right
-  auto rightmostCandidate = startingPoint;
-  while (true) {
-    ++rightmostCandidate;
-    // filter out non-fresh data
-    if (interest.getMustBeFresh()) {
-      rightmostCandidate = findNextFresh(rightmostCandidate);
-    }
+  // several packets with the same name match, return the one selectChild() would have returned
+  auto ordered = m_cache.get<byName>().equal_range(interest.getName());
+  return *std::find_if(ordered.first, ordered.second, matches);
+}
 
-    bool isInPrefix = false;
-    if (rightmostCandidate != m_cache.get<byFullName>().end()) {
-      isInPrefix = interest.getName().isPrefixOf((*rightmostCandidate)->getFullName());
-    }
-    if (isInPrefix) {
-      if (interest.matchesData((*rightmostCandidate)->getData())) {
-        return *rightmostCandidate;
-      }
+InMemoryStorageEntry*
+InMemoryStorage::selectChild(const Interest& interest,
+                             Cache::index<byName>::type::iterator startingPoint) const
+{
+  auto now = time::steady_clock::now();
+  for (auto it = startingPoint;
+       it != m_cache.get<byName>().end() && interest.getName().isPrefixOf((*it)->getName());
+       ++it) {
+    // filter out non-fresh data
+    if (interest.getMustBeFresh() && !(*it)->isFresh(now)) {
+      continue;
     }
-    else {
-      break;
+    if (interest.matchesData((*it)->getData())) {
+      return *it;
     }
   }
 
@@ -311,26 +394,33 @@ InMemoryStorage::Cache::iterator
 InMemoryStorage::freeEntry(Cache::iterator it)
 {
   // push the *empty* entry into mem pool
-  (*it)->release();
-  m_freeEntries.push(*it);
+  InMemoryStorageEntry* entry = *it;
+  // unlink the entry before releasing its Data, which provides the index keys
+  auto next = m_cache.erase(it);
+  m_nBytes -= entry->getWireSize() + getEntryOverhead();
+  entry->release();
+  m_freeEntries.push(entry);
   m_nPackets--;
-  return m_cache.erase(it);
+  return next;
 }
 
 void
 InMemoryStorage::erase(const Name& prefix, const bool isPrefix)
 {
   if (isPrefix) {
-    auto it = m_cache.get<byFullName>().lower_bound(prefix);
-    while (it != m_cache.get<byFullName>().end() && prefix.isPrefixOf((*it)->getName())) {
+    auto it = m_cache.get<byName>().lower_bound(prefix);
+    while (it != m_cache.get<byName>().end() && prefix.isPrefixOf((*it)->getName())) {
       // let derived class do something with the entry
       beforeErase(*it);
       it = freeEntry(it);
     }
   }
   else {
-    auto it = m_cache.get<byFullName>().find(prefix);
-    if (it == m_cache.get<byFullName>().end())
+    if (prefix.empty() || !prefix[-1].isImplicitSha256Digest())
+      return;
+
+    auto it = findFullName(prefix);
+    if (it == m_cache.end())
       return;
 
     // let derived class do something with the entry
@@ -345,24 +435,41 @@ InMemoryStorage::erase(const Name& prefix, const bool isPrefix)
 void
 InMemoryStorage::eraseImpl(const Name& name)
 {
-  auto it = m_cache.get<byFullName>().find(name);
-  if (it == m_cache.get<byFullName>().end())
+  if (name.empty() || !name[-1].isImplicitSha256Digest())
+    return;
+
+  auto it = findFullName(name);
+  if (it == m_cache.end())
     return;
 
   freeEntry(it);
 }
 
+void
+InMemoryStorage::eraseImpl(InMemoryStorageEntry* entry)
+{
+  auto range = m_cache.get<byExactName>().equal_range(entry->getName());
+  auto it = std::find(range.first, range.second, entry);
+  if (it == range.second)
+    return;
+
+  freeEntry(m_cache.project<byName>(it));
+}
+
 InMemoryStorage::const_iterator
 InMemoryStorage::begin() const
 {
-  auto it = m_cache.get<byFullName>().begin();
+  auto it = m_cache.get<byName>().begin();
+  if (it == m_cache.get<byName>().end()) {
+    return end();
+  }
   return const_iterator(&((*it)->getData()), &m_cache, it);
 }
 
 InMemoryStorage::const_iterator
 InMemoryStorage::end() const
 {
-  auto it = m_cache.get<byFullName>().end();
+  auto it = m_cache.get<byName>().end();
   return const_iterator(nullptr, &m_cache, it);
 }
 
@@ -385,7 +492,7 @@ void
 InMemoryStorage::printCache(std::ostream& os) const
 {
   // start from the upper layer towards bottom
-  for (const auto& elem : m_cache.get<byFullName>())
+  for (const auto& elem : m_cache.get<byName>())
     os << elem->getFullName() << std::endl;
 }
 
@@ -22,12 +22,14 @@
 #ifndef NDN_IMS_IN_MEMORY_STORAGE_HPP
 #define NDN_IMS_IN_MEMORY_STORAGE_HPP
 
+#include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/ims/in-memory-storage-entry.hpp"
 
 #include <iterator>
 #include <stack>
 
 #include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/member.hpp>
@@ -42,18 +44,30 @@ class InMemoryStorage : noncopyable
 {
 public:
   // multi_index_container to implement storage
-  class byFullName;
+  class byName;
+  class byExactName;
+  /// @deprecated The ordered index is keyed by Name rather than full name, use byName
+  using byFullName = byName;
 
   typedef boost::multi_index_container<
     InMemoryStorageEntry*,
     boost::multi_index::indexed_by<
 
-      // by Full Name
-      boost::multi_index::ordered_unique<
-        boost::multi_index::tag<byFullName>,
+      // by Name, ordered; packets with the same Name are kept in insertion order,
+      // so that the implicit digest is not needed to maintain the index
+      boost::multi_index::ordered_non_unique<
+        boost::multi_index::tag<byName>,
         boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
-                                          &InMemoryStorageEntry::getFullName>,
+                                          &InMemoryStorageEntry::getName>,
         std::less<Name>
+      >,
+
+      // by Name, for exact-name lookups of Interests without CanBePrefix
+      boost::multi_index::hashed_non_unique<
+        boost::multi_index::tag<byExactName>,
+        boost::multi_index::const_mem_fun<InMemoryStorageEntry, const Name&,
+                                          &InMemoryStorageEntry::getName>,
+        std::hash<Name>
       >
 
     >
@@ -73,7 +87,7 @@ public:
     using reference         = value_type&;
 
     const_iterator(const Data* ptr, const Cache* cache,
-                   Cache::index<byFullName>::type::iterator it);
+                   Cache::index<byName>::type::iterator it);
 
     const_iterator&
     operator++();
@@ -96,7 +110,7 @@ public:
   private:
     const Data* m_ptr;
     const Cache* m_cache;
-    Cache::index<byFullName>::type::iterator m_it;
+    Cache::index<byName>::type::iterator m_it;
   };
 
   /** @brief Represents an error might be thrown during reduce the current capacity of the
@@ -119,6 +133,9 @@ public:
 
   /** @brief Create a InMemoryStorage with up to @p limit entries
    *  The InMemoryStorage created through this method will handle MustBeFresh in interest processing
+   *
+   *  Staleness is determined on lookup by comparing the current time with each entry's stale
+   *  time, therefore no events are scheduled on @p ioService.
    */
   explicit
   InMemoryStorage(boost::asio::io_service& ioService,
@@ -141,11 +158,16 @@ public:
    *  will be placed in the in-memory storage.
    *
    *  @note It will invoke afterInsert(shared_ptr<InMemoryStorageEntry>).
+   *  @note If storing the packet would exceed the byte limit and the replacement policy cannot
+   *        evict enough packets to make room for it, the packet is not inserted.
    */
   void
   insert(const Data& data, const time::milliseconds& mustBeFreshProcessingWindow = INFINITE_WINDOW);
 
   /** @brief Finds the best match Data for an Interest
+   *
+   *  If the Interest does not have CanBePrefix, the Data is located through a hash table keyed
+   *  by exact name, instead of a search of the ordered index.
    *
    *  @note It will invoke afterAccess(shared_ptr<InMemoryStorageEntry>).
    *  As currently it is impossible to determine whether a Name contains implicit digest or not,
@@ -172,6 +194,16 @@ public:
   shared_ptr<const Data>
   find(const Name& name);
 
+  /** @brief Finds the Data that find(const Interest&) would return, without invoking afterAccess()
+   */
+  shared_ptr<const Data>
+  peek(const Interest& interest) const;
+
+  /** @brief Finds the Data that find(const Name&) would return, without invoking afterAccess()
+   */
+  shared_ptr<const Data>
+  peek(const Name& name) const;
+
   /** @brief Deletes in-memory storage entry by prefix by default.
    *  @param prefix Exact name of a prefix of the data to remove
    *  @param isPrefix If false, the function will only delete the
@@ -201,16 +233,71 @@ public:
     return m_nPackets;
   }
 
-  /** @brief Returns begin iterator of the in-memory storage ordering by
-   *  name with digest
+  /** @brief Sets the maximum memory usage of the in-memory storage, in bytes
+   *
+   *  Memory usage is accounted as the wire size of each stored packet plus a fixed per-entry
+   *  overhead (see getEntryOverhead()). Packets are evicted according to the replacement policy
+   *  until the memory usage fits within @p nMaxBytes.
+   *
+   *  @throw Error the replacement policy cannot evict enough packets
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
+  /** @return{ maximum memory usage of the in-memory storage in bytes, unlimited by default }
+   */
+  size_t
+  getByteLimit() const
+  {
+    return m_byteLimit;
+  }
+
+  /** @return{ memory usage of the stored packets in bytes, including per-entry overhead }
+   */
+  size_t
+  getNBytes() const
+  {
+    return m_nBytes;
+  }
+
+  /** @return{ number of stored packets whose implicit digest was computed by the storage }
+   *
+   *  The implicit digest of a packet is computed only when it is looked up or erased by a name
+   *  that ends with an ImplicitSha256DigestComponent, and only if the Data packet does not
+   *  have it cached already, e.g., because the application called Data::getFullName().
+   */
+  size_t
+  getNDigestComputations() const
+  {
+    return m_nDigestComputations;
+  }
+
+  /** @return{ part of getNBytes() that is per-entry overhead rather than packet wire encoding }
+   */
+  size_t
+  getNOverheadBytes() const
+  {
+    return m_nPackets * getEntryOverhead();
+  }
+
+  /** @brief Returns the estimated memory used by each entry in addition to the wire encoding
+   *
+   *  This accounts for the entry itself, the decoded Data object, and the index nodes.
+   */
+  static size_t
+  getEntryOverhead();
+
+  /** @brief Returns begin iterator of the in-memory storage ordering by Name
+   *
+   *  Packets with the same Name are visited in insertion order, not in the order of their
+   *  implicit digests.
    *
    *  @return{ const_iterator pointing to the beginning of the m_cache }
    */
   InMemoryStorage::const_iterator
   begin() const;
 
-  /** @brief Returns end iterator of the in-memory storage ordering by
-   *  name with digest
+  /** @brief Returns end iterator of the in-memory storage ordering by Name
    *
    *  @return{ const_iterator pointing to the end of the m_cache }
    */
@@ -280,6 +367,13 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   void
   eraseImpl(const Name& name);
 
+  /** @brief deletes an in-memory storage entry, without computing its implicit digest.
+   *
+   *  It won't invoke beforeErase(shared_ptr<Entry>).
+   */
+  void
+  eraseImpl(InMemoryStorageEntry* entry);
+
   /** @brief Prints contents of the in-memory storage
    */
   void
@@ -292,36 +386,52 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   Cache::iterator
   freeEntry(Cache::iterator it);
 
-  /** @brief Implements child selector (leftmost, rightmost, undeclared).
-   *  Operates on the first layer of a skip list.
+  /** @brief Find the entry whose full name equals @p fullName
    *
-   *  startingPoint must be less than Interest Name.
-   *  startingPoint can be equal to Interest Name only
-   *  when the item is in the begin() position.
+   *  Only entries whose Name equals @p fullName without its last component are examined, and
+   *  their implicit digests are computed as needed.
    *
-   *  Iterates toward greater Names, terminates when application cache entry falls out of Interest
-   *  prefix. When childSelector = leftmost, returns first application cache entry that satisfies
-   *  other selectors. When childSelector = rightmost, it goes till the end, and returns application
-   *  cache entry that satisfies other selectors. Returned application cache entry is the leftmost
-   *  child of the rightmost child.
-   *  @return{ the best match, if any; otherwise 0 }
+   *  @pre the last component of @p fullName is an ImplicitSha256DigestComponent
+   */
+  Cache::iterator
+  findFullName(const Name& fullName) const;
+
+  /** @brief Find the entry returned by find(const Name&)
    */
   InMemoryStorageEntry*
-  selectChild(const Interest& interest,
-              Cache::index<byFullName>::type::iterator startingPoint) const;
+  findEntry(const Name& name) const;
+
+  /** @brief Find the entry returned by find(const Interest&)
+   */
+  InMemoryStorageEntry*
+  findEntry(const Interest& interest) const;
+
+  /** @brief Find the leftmost Data whose Name equals the Interest Name and satisfies the Interest
+   */
+  InMemoryStorageEntry*
+  selectExact(const Interest& interest) const;
 
-  /** @brief Get the next iterator (include startingPoint) that satisfies MustBeFresh requirement
+  /** @brief Find the leftmost Data under the Interest Name that satisfies the Interest
    *
-   *  @param startingPoint The iterator to start with.
-   *  @return The next qualified iterator
+   *  startingPoint must be the first entry whose Name is not less than the Interest Name.
+   *  Iterates toward greater Names, and terminates when the entry falls out of Interest prefix.
+   *
+   *  @return{ the best match, if any; otherwise 0 }
    */
-  Cache::index<byFullName>::type::iterator
-  findNextFresh(Cache::index<byFullName>::type::iterator startingPoint) const;
+  InMemoryStorageEntry*
+  selectChild(const Interest& interest,
+              Cache::index<byName>::type::iterator startingPoint) const;
 
 private:
   void
   init();
 
+  /** @brief Evicts packets until @p nBytes more bytes fit within the byte limit
+   *  @return whether enough packets could be evicted
+   */
+  bool
+  evictBytes(size_t nBytes);
+
 public:
   static const time::milliseconds INFINITE_WINDOW;
 
@@ -338,10 +448,16 @@ private:
   size_t m_capacity;
   /// current number of packets in in-memory storage
   size_t m_nPackets;
+  /// user defined maximum memory usage of the in-memory storage in bytes
+  size_t m_byteLimit = std::numeric_limits<size_t>::max();
+  /// current memory usage of the in-memory storage in bytes, including per-entry overhead
+  size_t m_nBytes = 0;
   /// memory pool
   std::stack<InMemoryStorageEntry*> m_freeEntries;
-  /// scheduler
-  unique_ptr<Scheduler> m_scheduler;
+  /// number of implicit digests computed by lookups and erasures
+  mutable size_t m_nDigestComputations = 0;
+  /// whether entries become stale after their MustBeFresh processing window
+  bool m_isFreshnessTracked = false;
 };
 
 } // namespace ndn
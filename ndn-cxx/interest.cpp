@@ -50,6 +50,7 @@ bool Interest::s_errorIfCanBePrefixUnset = true;
 #endif // NDN_CXX_HAVE_TESTS
 boost::logic::tribool Interest::s_defaultCanBePrefix = boost::logic::indeterminate;
 bool Interest::s_autoCheckParametersDigest = true;
+bool Interest::s_lazyDecoding = false;
 
 Interest::Interest(const Name& name, time::milliseconds lifetime)
 {
@@ -143,6 +144,9 @@ Interest::wireEncode(EncodingImpl<TAG>& encoder) const
   totalLength += encoder.prependByteArrayBlock(tlv::Nonce, m_nonce->data(), m_nonce->size());
 
   // ForwardingHint
+  if (m_forwardingHint.hasError()) {
+    NDN_THROW(Error("ForwardingHint element is malformed"));
+  }
   if (!getForwardingHint().empty()) {
     totalLength += getForwardingHint().wireEncode(encoder);
   }
@@ -220,7 +224,7 @@ Interest::wireDecode(const Block& wire)
 
   m_isCanBePrefixSet = true; // don't trigger warning from decoded packet
   m_canBePrefix = m_mustBeFresh = false;
-  m_forwardingHint = {};
+  m_forwardingHint.set({});
   m_nonce.reset();
   m_interestLifetime = DEFAULT_INTEREST_LIFETIME;
   m_hopLimit.reset();
@@ -255,7 +259,12 @@ Interest::wireDecode(const Block& wire)
         if (lastElement >= 4) {
           NDN_THROW(Error("ForwardingHint element is out of order"));
         }
-        m_forwardingHint.wireDecode(*element);
+        if (s_lazyDecoding) {
+          m_forwardingHint.defer(*element);
+        }
+        else {
+          m_forwardingHint.decode(*element);
+        }
         lastElement = 4;
         break;
       }
@@ -392,7 +401,7 @@ Interest::setName(const Name& name)
 Interest&
 Interest::setForwardingHint(const DelegationList& value)
 {
-  m_forwardingHint = value;
+  m_forwardingHint.set(value);
   m_wire.reset();
   return *this;
 }
@@ -23,6 +23,7 @@
 #define NDN_CXX_INTEREST_HPP
 
 #include "ndn-cxx/delegation-list.hpp"
+#include "ndn-cxx/detail/deferred-element.hpp"
 #include "ndn-cxx/detail/packet-base.hpp"
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/security/security-common.hpp"
@@ -241,10 +242,15 @@ public: // element access
     return *this;
   }
 
+  /** @brief Get the ForwardingHint
+   *
+   *  If decoding of the ForwardingHint was deferred (see setLazyDecoding()) and has failed,
+   *  this returns an empty DelegationList.
+   */
   const DelegationList&
   getForwardingHint() const noexcept
   {
-    return m_forwardingHint;
+    return m_forwardingHint.get();
   }
 
   Interest&
@@ -259,12 +265,13 @@ public: // element access
    *  modifier(fh);
    *  interest.setForwardingHint(fh);
    *  @endcode
+   *  @throw tlv::Error ForwardingHint decoding was deferred (see setLazyDecoding()) and has failed
    */
   template<typename Modifier>
   Interest&
   modifyForwardingHint(const Modifier& modifier)
   {
-    modifier(m_forwardingHint);
+    modifier(m_forwardingHint.modify());
     m_wire.reset();
     return *this;
   }
@@ -466,6 +473,42 @@ public: // ParametersSha256DigestComponent support
   bool
   isParametersDigestValid() const;
 
+public: // lazy decoding
+  static bool
+  getLazyDecoding()
+  {
+    return s_lazyDecoding;
+  }
+
+  /** @brief Enable or disable lazy decoding in wireDecode()
+   *
+   *  When enabled, wireDecode() defers decoding of the ForwardingHint until it is first accessed,
+   *  so that applications that do not look at it, such as consumers and producers, avoid the
+   *  cost of decoding its delegations.
+   *
+   *  A malformed ForwardingHint is not reported by wireDecode(). Instead, getForwardingHint()
+   *  returns an empty DelegationList, and modifying the ForwardingHint or encoding the packet
+   *  again throws tlv::Error. hasMalformedElement() detects this case.
+   *
+   *  Lazy decoding is disabled by default.
+   */
+  static void
+  setLazyDecoding(bool b)
+  {
+    s_lazyDecoding = b;
+  }
+
+  /** @brief Check whether a ForwardingHint whose decoding was deferred is malformed
+   *
+   *  This decodes the ForwardingHint if it has not been accessed yet. It always returns false
+   *  for a packet decoded without lazy decoding, because wireDecode() would have thrown.
+   */
+  bool
+  hasMalformedElement() const noexcept
+  {
+    return m_forwardingHint.hasError();
+  }
+
 private:
   void
   setApplicationParametersInternal(Block parameters);
@@ -504,9 +547,10 @@ public:
 private:
   static boost::logic::tribool s_defaultCanBePrefix;
   static bool s_autoCheckParametersDigest;
+  static bool s_lazyDecoding;
 
   Name m_name;
-  DelegationList m_forwardingHint;
+  detail::DeferredElement<DelegationList> m_forwardingHint;
   mutable optional<Nonce> m_nonce;
   time::milliseconds m_interestLifetime;
   optional<uint8_t> m_hopLimit;
@@ -28,8 +28,8 @@
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/util/time.hpp"
 
+#include <cstring>
 #include <sstream>
-#include <boost/functional/hash.hpp>
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/concepts.hpp>
 
@@ -154,6 +154,7 @@ Name::wireDecode(const Block& wire)
 
   m_wire = wire;
   m_wire.parse();
+  m_hash.store(0);
 }
 
 Name
@@ -211,6 +212,7 @@ Name::set(ssize_t i, const Component& component)
 
   const_cast<Block::element_container&>(m_wire.elements())[i] = component;
   m_wire.resetWire();
+  m_hash.store(0);
   return *this;
 }
 
@@ -223,6 +225,7 @@ Name::set(ssize_t i, Component&& component)
 
   const_cast<Block::element_container&>(m_wire.elements())[i] = std::move(component);
   m_wire.resetWire();
+  m_hash.store(0);
   return *this;
 }
 
@@ -274,12 +277,14 @@ Name::erase(ssize_t i)
   }
 
   m_wire.erase(m_wire.elements_begin() + i);
+  m_hash.store(0);
 }
 
 void
 Name::clear()
 {
   m_wire = Block(tlv::Name);
+  m_hash.store(0);
 }
 
 // ---- algorithms ----
@@ -317,6 +322,17 @@ Name::equals(const Name& other) const
   if (size() != other.size())
     return false;
 
+  size_t hash = m_hash.load();
+  size_t otherHash = other.m_hash.load();
+  if (hash != 0 && otherHash != 0 && hash != otherHash)
+    return false;
+
+  if (hasWire() && other.hasWire() && m_wire.size() == other.m_wire.size() &&
+      std::memcmp(m_wire.wire(), other.m_wire.wire(), m_wire.size()) == 0) {
+    // identical wire encoding, compared in one pass
+    return true;
+  }
+
   for (size_t i = 0; i < size(); ++i) {
     if (get(i) != other.get(i))
       return false;
@@ -325,6 +341,21 @@ Name::equals(const Name& other) const
   return true;
 }
 
+/** @brief Compare two name components in canonical order
+ *
+ *  This is equivalent to Component::compare, with the common case of components that both
+ *  have wire encoding handled inline.
+ */
+static inline int
+compareComponents(const name::Component& lhs, const name::Component& rhs)
+{
+  if (lhs.hasWire() && rhs.hasWire()) {
+    // lexical order of TLV encoding is the same as canonical order of name components
+    return std::memcmp(lhs.wire(), rhs.wire(), std::min(lhs.size(), rhs.size()));
+  }
+  return lhs.compare(rhs);
+}
+
 int
 Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t count2) const
 {
@@ -332,8 +363,10 @@ Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t
   count2 = std::min(count2, other.size() - pos2);
   size_t count = std::min(count1, count2);
 
+  const_iterator lhs = begin() + pos1;
+  const_iterator rhs = other.begin() + pos2;
   for (size_t i = 0; i < count; ++i) {
-    int comp = get(pos1 + i).compare(other.get(pos2 + i));
+    int comp = compareComponents(lhs[i], rhs[i]);
     if (comp != 0) { // i-th component differs
       return comp;
     }
@@ -342,6 +375,61 @@ Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t
   return count1 - count2;
 }
 
+// ---- hashing ----
+
+/** @brief Hash a name component into @p seed
+ *
+ *  The hash is computed over TLV-TYPE and TLV-VALUE, so that it does not depend on whether the
+ *  component has wire encoding. TLV-VALUE is consumed 8 octets at a time.
+ */
+static size_t
+hashComponent(const name::Component& component, uint64_t seed)
+{
+  const uint64_t k = 0x9e3779b97f4a7c15ULL;
+  auto mix = [k] (uint64_t h, uint64_t word) {
+    h = (h ^ word) * k;
+    return h ^ (h >> 32);
+  };
+
+  const uint8_t* value = component.value();
+  size_t size = component.value_size();
+  uint64_t h = mix(seed, (static_cast<uint64_t>(component.type()) << 32) | size);
+  for (; size >= sizeof(uint64_t); value += sizeof(uint64_t), size -= sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, value, sizeof(word));
+    h = mix(h, word);
+  }
+  if (size > 0) {
+    uint64_t word = 0;
+    std::memcpy(&word, value, size);
+    h = mix(h, word);
+  }
+  return static_cast<size_t>(h);
+}
+
+// zero is reserved to indicate that the hash value of a Name has not been computed
+static inline size_t
+finalizeHash(size_t h)
+{
+  return h == 0 ? 1 : h;
+}
+
+size_t
+Name::hashComponents(const_iterator first, const_iterator last)
+{
+  size_t h = 0;
+  for (; first != last; ++first) {
+    h = hashComponent(*first, h);
+  }
+  return finalizeHash(h);
+}
+
+size_t
+Name::computeHash() const
+{
+  return hashComponents(begin(), end());
+}
+
 // ---- URI representation ----
 
 void
@@ -383,8 +471,7 @@ namespace std {
 size_t
 hash<ndn::Name>::operator()(const ndn::Name& name) const
 {
-  return boost::hash_range(name.wireEncode().wire(),
-                           name.wireEncode().wire() + name.wireEncode().size());
+  return name.getHash();
 }
 
 } // namespace std
@@ -28,6 +28,7 @@
 
 #include "ndn-cxx/name-component.hpp"
 
+#include <atomic>
 #include <iterator>
 
 namespace ndn {
@@ -278,6 +279,7 @@ public: // modifiers
   append(const Component& component)
   {
     m_wire.push_back(component);
+    m_hash.store(0);
     return *this;
   }
 
@@ -288,6 +290,7 @@ public: // modifiers
   append(Component&& component)
   {
     m_wire.push_back(std::move(component));
+    m_hash.store(0);
     return *this;
   }
 
@@ -364,6 +367,7 @@ public: // modifiers
     else {
       m_wire.push_back(Block(tlv::GenericNameComponent, std::move(value)));
     }
+    m_hash.store(0);
     return *this;
   }
 
@@ -559,6 +563,44 @@ public: // algorithms
   bool
   equals(const Name& other) const;
 
+  /** @brief Return a hash value of this name
+   *
+   *  The hash value is computed from the name components, so that it does not require wire
+   *  encoding, and is cached until the name is modified. It equals `std::hash<Name>{}(*this)`.
+   */
+  size_t
+  getHash() const
+  {
+    size_t hash = m_hash.load();
+    if (hash == 0) {
+      hash = computeHash();
+      m_hash.store(hash);
+    }
+    return hash;
+  }
+
+  /** @brief Return the hash value of a prefix of this name
+   *  @param nComponents number of components; if negative, size()+nComponents is used instead
+   *
+   *  The result equals `getPrefix(nComponents).getHash()`, but the prefix is not constructed.
+   *  This allows looking up all prefixes of a name in a hash table keyed by Name, together with
+   *  a hasher that uses getHash() and an equality test on components.
+   */
+  size_t
+  getPrefixHash(ssize_t nComponents) const
+  {
+    if (nComponents < 0)
+      nComponents += size();
+    return hashComponents(begin(), begin() + std::min<size_t>(nComponents, size()));
+  }
+
+  /** @brief Return the hash value of a sequence of name components
+   *
+   *  The result equals getHash() of a Name made of the components in [@p first, @p last).
+   */
+  static size_t
+  hashComponents(const_iterator first, const_iterator last);
+
   /** @brief Compare this to the other Name using NDN canonical ordering.
    *
    *  If the first components of each name are not equal, this returns a negative value if
@@ -650,8 +692,52 @@ public:
    */
   static const size_t npos;
 
+private:
+  size_t
+  computeHash() const;
+
+  /** @brief Cached hash value, zero if not computed
+   *
+   *  The value is accessed atomically, so that getHash() may be called concurrently on the
+   *  same Name from multiple threads. Relaxed ordering suffices because any thread that
+   *  computes the value obtains the same result.
+   */
+  class HashCache
+  {
+  public:
+    HashCache() noexcept = default;
+
+    HashCache(const HashCache& other) noexcept
+      : m_value(other.load())
+    {
+    }
+
+    HashCache&
+    operator=(const HashCache& other) noexcept
+    {
+      store(other.load());
+      return *this;
+    }
+
+    size_t
+    load() const noexcept
+    {
+      return m_value.load(std::memory_order_relaxed);
+    }
+
+    void
+    store(size_t value) const noexcept
+    {
+      m_value.store(value, std::memory_order_relaxed);
+    }
+
+  private:
+    mutable std::atomic<size_t> m_value{0};
+  };
+
 private:
   mutable Block m_wire;
+  HashCache m_hash;
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(Name);
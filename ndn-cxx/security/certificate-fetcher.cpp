@@ -35,6 +35,7 @@ NDN_LOG_INIT(ndn.security.CertificateFetcher);
 
 CertificateFetcher::CertificateFetcher()
   : m_certStorage(nullptr)
+  , m_pendingFetches(make_shared<PendingFetches>())
 {
 }
 
@@ -59,13 +60,83 @@ CertificateFetcher::fetch(const shared_ptr<CertificateRequest>& certRequest,
     return;
   }
 
+  const Name& certName = certRequest->interest.getName();
+  std::vector<Waiter> waiters;
+  auto it = m_pendingFetches->find(certName);
+  if (it != m_pendingFetches->end()) {
+    auto inFlightState = it->second.state.lock();
+    if (inFlightState != nullptr && boost::logic::indeterminate(inFlightState->getOutcome())) {
+      if (it->second.request == certRequest) {
+        // retry of the in-flight fetch, whose continuation already resumes the coalesced requests
+        doFetch(certRequest, state, continueValidation);
+      }
+      else {
+        NDN_LOG_DEBUG_DEPTH("Waiting for in-flight fetch of " << certName);
+        it->second.waiters.push_back({state, continueValidation});
+      }
+      return;
+    }
+
+    // the in-flight state has finished without resuming the coalesced requests,
+    // which now wait for this request instead
+    waiters = std::move(it->second.waiters);
+    m_pendingFetches->erase(it);
+  }
+
+  auto& pendingFetch = (*m_pendingFetches)[certName];
+  pendingFetch.request = certRequest;
+  pendingFetch.state = state;
+  pendingFetch.waiters = std::move(waiters);
+
+  // the state may already be fetching through an outer fetcher, e.g., CertificateBundleFetcher
+  auto outerFailureCallback = std::move(state->m_coalescedFailureCallback);
+  // the state may outlive this fetcher
+  weak_ptr<PendingFetches> weakPendingFetches = m_pendingFetches;
+  state->m_coalescedFailureCallback = [=] (const ValidationError& error) {
+    auto pendingFetches = weakPendingFetches.lock();
+    if (pendingFetches != nullptr) {
+      for (const auto& waiter : finishPendingFetch(*pendingFetches, certName, certRequest)) {
+        waiter.state->fail(error);
+      }
+    }
+    if (outerFailureCallback != nullptr) {
+      outerFailureCallback(error);
+    }
+  };
+
   doFetch(certRequest, state,
-          [continueValidation, this] (const Certificate& cert, const shared_ptr<ValidationState>& state) {
+          [continueValidation, certName, certRequest, this] (const Certificate& cert,
+                                                            const shared_ptr<ValidationState>& state) {
             m_certStorage->cacheUnverifiedCert(Certificate(cert));
-            continueValidation(cert, state);
+            state->m_coalescedFailureCallback = nullptr;
+            auto waiters = finishPendingFetch(*m_pendingFetches, certName, certRequest);
+            if (waiters.empty()) {
+              return continueValidation(cert, state);
+            }
+
+            // cert may be invalidated by the continuations
+            Certificate fetchedCert(cert);
+            continueValidation(fetchedCert, state);
+            for (const auto& waiter : waiters) {
+              waiter.continueValidation(fetchedCert, waiter.state);
+            }
           });
 }
 
+std::vector<CertificateFetcher::Waiter>
+CertificateFetcher::finishPendingFetch(PendingFetches& pendingFetches, const Name& certName,
+                                       const shared_ptr<CertificateRequest>& certRequest)
+{
+  auto it = pendingFetches.find(certName);
+  if (it == pendingFetches.end() || it->second.request != certRequest) {
+    return {};
+  }
+
+  auto waiters = std::move(it->second.waiters);
+  pendingFetches.erase(it);
+  return waiters;
+}
+
 } // inline namespace v2
 } // namespace security
 } // namespace ndn
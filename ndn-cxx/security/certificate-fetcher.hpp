@@ -22,7 +22,9 @@
 #ifndef NDN_SECURITY_CERTIFICATE_FETCHER_HPP
 #define NDN_SECURITY_CERTIFICATE_FETCHER_HPP
 
-#include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/name.hpp"
+
+#include <map>
 
 namespace ndn {
 namespace security {
@@ -67,6 +69,12 @@ public:
    * When the requested certificate is retrieved, continueValidation is called.  Otherwise, the
    * fetcher implementation call state->failed() with the appropriate error code and diagnostic
    * message.
+   *
+   * Requests for a certificate name that is already being fetched for another state are
+   * coalesced with the in-flight request: they wait for its outcome instead of invoking doFetch,
+   * and continue or fail together with it.  Retries and backoff are governed by the in-flight
+   * request.  Calling this method again with the in-flight @p certRequest, as implementations do
+   * to retry, continues the in-flight fetch.
    */
   void
   fetch(const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state,
@@ -82,6 +90,38 @@ private:
 
 protected:
   CertificateStorage* m_certStorage;
+
+private:
+  struct Waiter
+  {
+    shared_ptr<ValidationState> state;
+    ValidationContinuation continueValidation;
+  };
+
+  struct PendingFetch
+  {
+    shared_ptr<CertificateRequest> request; ///< request for which doFetch was invoked
+    weak_ptr<ValidationState> state; ///< state for which doFetch was invoked
+    std::vector<Waiter> waiters; ///< coalesced requests
+  };
+
+  using PendingFetches = std::map<Name, PendingFetch>;
+
+  /**
+   * @brief Remove the in-flight fetch of @p certName, if it was started by @p certRequest
+   * @return the coalesced requests waiting for the fetch
+   */
+  static std::vector<Waiter>
+  finishPendingFetch(PendingFetches& pendingFetches, const Name& certName,
+                     const shared_ptr<CertificateRequest>& certRequest);
+
+  /**
+   * @brief In-flight fetches by certificate name
+   *
+   * Shared with the failure callbacks installed on the in-flight states, which may outlive
+   * the fetcher.
+   */
+  shared_ptr<PendingFetches> m_pendingFetches;
 };
 
 } // inline namespace v2
@@ -106,6 +106,12 @@ CertificateStorage::getUnverifiedCertCache() const
   return m_unverifiedCertCache;
 }
 
+const PublicKeyCache&
+CertificateStorage::getPublicKeyCache() const
+{
+  return m_publicKeyCache;
+}
+
 } // inline namespace v2
 } // namespace security
 } // namespace ndn
@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/security/certificate.hpp"
 #include "ndn-cxx/security/certificate-cache.hpp"
+#include "ndn-cxx/security/public-key-cache.hpp"
 #include "ndn-cxx/security/trust-anchor-container.hpp"
 
 namespace ndn {
@@ -32,6 +33,9 @@ inline namespace v2 {
 
 /**
  * @brief Storage for trusted anchors, verified certificate cache, and unverified certificate cache.
+ *
+ * The storage also keeps a cache of parsed public keys of the trusted certificates that are used
+ * to verify signatures.
  */
 class CertificateStorage : noncopyable
 {
@@ -82,6 +86,12 @@ public:
   const CertificateCache&
   getUnverifiedCertCache() const;
 
+  /**
+   * @return Cache of parsed public keys
+   */
+  const PublicKeyCache&
+  getPublicKeyCache() const;
+
 protected:
   /**
    * @brief load static trust anchor.
@@ -134,6 +144,7 @@ protected:
   TrustAnchorContainer m_trustAnchors;
   CertificateCache m_verifiedCertCache;
   CertificateCache m_unverifiedCertCache;
+  PublicKeyCache m_publicKeyCache;
 };
 
 } // inline namespace v2
@@ -442,6 +442,11 @@ KeyChain::importPrivateKey(const Name& keyName, shared_ptr<transform::PrivateKey
 
 // public: signing
 
+// maximum size of the outermost TLV-TYPE and TLV-LENGTH of a Data packet
+static const size_t MAX_DATA_TL_SIZE = 1 + 9;
+// room for the SignatureValue element, large enough for an RSA-4096 signature
+static const size_t SIGNATURE_VALUE_RESERVE = 4 + 512;
+
 void
 KeyChain::sign(Data& data, const SigningInfo& params)
 {
@@ -451,7 +456,13 @@ KeyChain::sign(Data& data, const SigningInfo& params)
 
   data.setSignatureInfo(sigInfo);
 
-  EncodingBuffer encoder;
+  // Size the buffer for the unsigned portion, plus room for the outermost TLV-TYPE and
+  // TLV-LENGTH in front and for the SignatureValue at the back, so that a typical
+  // signed Data is encoded without reallocating the buffer.
+  EncodingEstimator estimator;
+  size_t unsignedSize = data.wireEncode(estimator, true);
+  EncodingBuffer encoder(unsignedSize + MAX_DATA_TL_SIZE + SIGNATURE_VALUE_RESERVE,
+                         SIGNATURE_VALUE_RESERVE);
   data.wireEncode(encoder, true);
 
   Block sigValue(tlv::SignatureValue,
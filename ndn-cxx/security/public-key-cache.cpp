@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/public-key-cache.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/util/logger.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+
+NDN_LOG_INIT(ndn.security.PublicKeyCache);
+
+size_t
+PublicKeyCache::getDefaultCapacity()
+{
+  return 1000;
+}
+
+PublicKeyCache::PublicKeyCache(size_t capacity)
+  : m_capacity(capacity)
+{
+  BOOST_ASSERT(m_capacity > 0);
+}
+
+PublicKeyCache::~PublicKeyCache() = default;
+
+shared_ptr<const transform::PublicKey>
+PublicKeyCache::get(const Certificate& cert)
+{
+  if (!cert.hasWire()) {
+    ++m_counters.nMisses;
+    return parse(cert);
+  }
+
+  const Name& fullName = cert.getFullName();
+  auto& byName = m_entries.get<1>();
+  auto it = byName.find(fullName);
+  if (it != byName.end()) {
+    ++m_counters.nHits;
+    m_entries.relocate(m_entries.begin(), m_entries.project<0>(it));
+    return it->key;
+  }
+
+  ++m_counters.nMisses;
+  auto key = parse(cert);
+  if (key == nullptr) {
+    return nullptr;
+  }
+
+  NDN_LOG_TRACE("Caching public key of " << cert.getName());
+  m_entries.push_front({fullName, key});
+  if (m_entries.size() > m_capacity) {
+    m_entries.pop_back();
+  }
+  return key;
+}
+
+void
+PublicKeyCache::clear()
+{
+  m_entries.clear();
+}
+
+shared_ptr<const transform::PublicKey>
+PublicKeyCache::parse(const Certificate& cert)
+{
+  auto key = make_shared<transform::PublicKey>();
+  try {
+    key->loadPkcs8(cert.getContent().value(), cert.getContent().value_size());
+  }
+  catch (const transform::PublicKey::Error& e) {
+    NDN_LOG_DEBUG("Cannot parse public key of " << cert.getName() << ": " << e.what());
+    return nullptr;
+  }
+  return key;
+}
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
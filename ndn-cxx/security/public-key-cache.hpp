@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_SECURITY_PUBLIC_KEY_CACHE_HPP
+#define NDN_SECURITY_PUBLIC_KEY_CACHE_HPP
+
+#include "ndn-cxx/security/certificate.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+
+namespace ndn {
+namespace security {
+
+namespace transform {
+class PublicKey;
+} // namespace transform
+
+inline namespace v2 {
+
+/**
+ * @brief Bounded cache of parsed public keys of certificates.
+ *
+ * Loading the public key of a certificate into a transform::PublicKey requires parsing its
+ * PKCS #8 encoding, which is expensive compared to the signature verification itself when many
+ * packets are signed by the same few keys.  This cache keeps the parsed keys of the most
+ * recently used certificates.
+ *
+ * Entries are keyed by the full name of the certificate, which includes its implicit digest,
+ * so that a cached key is never used for a different certificate with the same name.  When the
+ * cache is full, the least recently used entry is evicted.
+ */
+class PublicKeyCache : noncopyable
+{
+public:
+  /**
+   * @brief Cache statistics
+   */
+  struct Counters
+  {
+    uint64_t nHits = 0;    ///< number of lookups that found a parsed key
+    uint64_t nMisses = 0;  ///< number of lookups that required parsing the key
+  };
+
+  /**
+   * @brief Create a cache that keeps at most @p capacity parsed keys.
+   * @pre capacity > 0
+   */
+  explicit
+  PublicKeyCache(size_t capacity = getDefaultCapacity());
+
+  ~PublicKeyCache();
+
+  /**
+   * @brief Get the parsed public key of @p cert
+   *
+   * The key is parsed and inserted into the cache if it is not already cached.
+   *
+   * @return The parsed public key, or nullptr if the key of @p cert cannot be parsed.
+   * @note A certificate without wire encoding is parsed every time and not cached.
+   */
+  shared_ptr<const transform::PublicKey>
+  get(const Certificate& cert);
+
+  /**
+   * @brief Remove all parsed keys from the cache
+   */
+  void
+  clear();
+
+  size_t
+  size() const
+  {
+    return m_entries.size();
+  }
+
+  size_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+  const Counters&
+  getCounters() const noexcept
+  {
+    return m_counters;
+  }
+
+  static size_t
+  getDefaultCapacity();
+
+private:
+  static shared_ptr<const transform::PublicKey>
+  parse(const Certificate& cert);
+
+private:
+  struct Entry
+  {
+    Name certFullName;
+    shared_ptr<const transform::PublicKey> key;
+  };
+
+  using EntryContainer = boost::multi_index::multi_index_container<
+    Entry,
+    boost::multi_index::indexed_by<
+      boost::multi_index::sequenced<>,
+      boost::multi_index::hashed_unique<
+        boost::multi_index::member<Entry, Name, &Entry::certFullName>,
+        std::hash<Name>
+      >
+    >
+  >;
+
+  EntryContainer m_entries; // ordered from most to least recently used
+  size_t m_capacity;
+  Counters m_counters;
+};
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_SECURITY_PUBLIC_KEY_CACHE_HPP
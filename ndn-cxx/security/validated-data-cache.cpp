@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/validated-data-cache.hpp"
+#include "ndn-cxx/util/logger.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+
+NDN_LOG_INIT(ndn.security.ValidatedDataCache);
+
+time::nanoseconds
+ValidatedDataCache::getDefaultLifetime()
+{
+  return 1_min;
+}
+
+ValidatedDataCache::ValidatedDataCache(size_t capacity, const time::nanoseconds& maxLifetime)
+  : m_capacity(capacity)
+  , m_maxLifetime(maxLifetime)
+{
+  BOOST_ASSERT(m_capacity > 0);
+}
+
+void
+ValidatedDataCache::insert(const Name& fullName, const time::system_clock::TimePoint& notAfter)
+{
+  auto now = time::system_clock::now();
+  if (notAfter < now) {
+    NDN_LOG_DEBUG("Not adding " << fullName << ": signing certificate expired at "
+                  << time::toIsoString(notAfter));
+    return;
+  }
+
+  auto removalTime = std::min(notAfter, now + m_maxLifetime);
+  auto& byName = m_entries.get<1>();
+  auto it = byName.find(fullName);
+  if (it != byName.end()) {
+    byName.modify(it, [removalTime] (Entry& entry) { entry.removalTime = removalTime; });
+    return;
+  }
+
+  refresh();
+  if (m_entries.size() >= m_capacity) {
+    m_entries.get<0>().erase(m_entries.get<0>().begin());
+  }
+  m_entries.insert({fullName, removalTime});
+}
+
+bool
+ValidatedDataCache::contains(const Name& fullName) const
+{
+  const_cast<ValidatedDataCache*>(this)->refresh();
+  return m_entries.get<1>().count(fullName) > 0;
+}
+
+void
+ValidatedDataCache::clear()
+{
+  m_entries.clear();
+}
+
+size_t
+ValidatedDataCache::size() const
+{
+  const_cast<ValidatedDataCache*>(this)->refresh();
+  return m_entries.size();
+}
+
+void
+ValidatedDataCache::refresh()
+{
+  auto now = time::system_clock::now();
+  auto& byTime = m_entries.get<0>();
+  byTime.erase(byTime.begin(), byTime.lower_bound(now));
+}
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
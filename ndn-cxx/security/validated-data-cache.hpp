@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_SECURITY_VALIDATED_DATA_CACHE_HPP
+#define NDN_SECURITY_VALIDATED_DATA_CACHE_HPP
+
+#include "ndn-cxx/name.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/member.hpp>
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+
+/**
+ * @brief Represents a bounded container of the full names of successfully validated Data packets.
+ *
+ * An entry is removed no later than the earliest NotAfter time of the certificates that were
+ * used to validate the packet, or maxLifetime after it has been added to the cache.  When the
+ * cache is full, the entry that would be removed first is evicted.
+ */
+class ValidatedDataCache : noncopyable
+{
+public:
+  /**
+   * @brief Create a cache of validated Data packets.
+   *
+   * @param capacity    maximum number of entries, must be positive
+   * @param maxLifetime the maximum time that an entry could live inside the cache
+   */
+  explicit
+  ValidatedDataCache(size_t capacity, const time::nanoseconds& maxLifetime = getDefaultLifetime());
+
+  /**
+   * @brief Insert the full name of a validated Data packet into the cache.
+   *
+   * @param fullName  full name of the Data packet, including the implicit digest
+   * @param notAfter  the earliest NotAfter time of the certificates used to validate the packet
+   */
+  void
+  insert(const Name& fullName, const time::system_clock::TimePoint& notAfter);
+
+  /**
+   * @brief Check whether a Data packet with @p fullName has been validated.
+   */
+  bool
+  contains(const Name& fullName) const;
+
+  /**
+   * @brief Remove all entries from the cache.
+   */
+  void
+  clear();
+
+  size_t
+  size() const;
+
+  size_t
+  getCapacity() const
+  {
+    return m_capacity;
+  }
+
+public:
+  static time::nanoseconds
+  getDefaultLifetime();
+
+private:
+  struct Entry
+  {
+    Name fullName;
+    time::system_clock::TimePoint removalTime;
+  };
+
+  /**
+   * @brief Remove all outdated entries.
+   */
+  void
+  refresh();
+
+private:
+  using EntryIndex = boost::multi_index::multi_index_container<
+    Entry,
+    boost::multi_index::indexed_by<
+      boost::multi_index::ordered_non_unique<
+        boost::multi_index::member<Entry, time::system_clock::TimePoint, &Entry::removalTime>
+      >,
+      boost::multi_index::ordered_unique<
+        boost::multi_index::member<Entry, Name, &Entry::fullName>
+      >
+    >
+  >;
+
+  EntryIndex m_entries;
+  size_t m_capacity;
+  time::nanoseconds m_maxLifetime;
+};
+
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_SECURITY_VALIDATED_DATA_CACHE_HPP
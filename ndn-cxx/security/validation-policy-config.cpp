@@ -76,6 +76,8 @@ ValidationPolicyConfig::load(const ConfigSection& configSection, const std::stri
   }
   if (m_isConfigured) {
     m_shouldBypass = false;
+    m_dataRuleIndex.clear();
+    m_interestRuleIndex.clear();
     m_dataRules.clear();
     m_interestRules.clear();
     m_validator->resetAnchors();
@@ -90,9 +92,11 @@ ValidationPolicyConfig::load(const ConfigSection& configSection, const std::stri
     if (boost::iequals(sectionName, "rule")) {
       auto rule = Rule::create(section, filename);
       if (rule->getPktType() == tlv::Data) {
+        m_dataRuleIndex.insert(*rule);
         m_dataRules.push_back(std::move(rule));
       }
       else if (rule->getPktType() == tlv::Interest) {
+        m_interestRuleIndex.insert(*rule);
         m_interestRules.push_back(std::move(rule));
       }
     }
@@ -245,14 +249,13 @@ ValidationPolicyConfig::checkPolicy(const Data& data, const shared_ptr<Validatio
     return;
   }
 
-  for (const auto& rule : m_dataRules) {
-    if (rule->match(tlv::Data, data.getName(), state)) {
-      if (rule->check(tlv::Data, data.getName(), klName, state)) {
-        return continueValidation(make_shared<CertificateRequest>(klName), state);
-      }
-      // rule->check calls state->fail(...) if the check fails
-      return;
+  const Rule* rule = m_dataRuleIndex.match(tlv::Data, data.getName(), state);
+  if (rule != nullptr) {
+    if (rule->check(tlv::Data, data.getName(), klName, state)) {
+      return continueValidation(make_shared<CertificateRequest>(klName), state);
     }
+    // rule->check calls state->fail(...) if the check fails
+    return;
   }
 
   return state->fail({ValidationError::POLICY_ERROR,
@@ -274,14 +277,13 @@ ValidationPolicyConfig::checkPolicy(const Interest& interest, const shared_ptr<V
     return;
   }
 
-  for (const auto& rule : m_interestRules) {
-    if (rule->match(tlv::Interest, interest.getName(), state)) {
-      if (rule->check(tlv::Interest, interest.getName(), klName, state)) {
-        return continueValidation(make_shared<CertificateRequest>(klName), state);
-      }
-      // rule->check calls state->fail(...) if the check fails
-      return;
+  const Rule* rule = m_interestRuleIndex.match(tlv::Interest, interest.getName(), state);
+  if (rule != nullptr) {
+    if (rule->check(tlv::Interest, interest.getName(), klName, state)) {
+      return continueValidation(make_shared<CertificateRequest>(klName), state);
     }
+    // rule->check calls state->fail(...) if the check fails
+    return;
   }
 
   return state->fail({ValidationError::POLICY_ERROR,
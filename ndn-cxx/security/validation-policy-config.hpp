@@ -23,7 +23,7 @@
 #define NDN_SECURITY_VALIDATION_POLICY_CONFIG_HPP
 
 #include "ndn-cxx/security/validation-policy.hpp"
-#include "ndn-cxx/security/validator-config/rule.hpp"
+#include "ndn-cxx/security/validator-config/rule-index.hpp"
 
 namespace ndn {
 namespace security {
@@ -99,6 +99,11 @@ NDN_CXX_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
   std::vector<unique_ptr<Rule>> m_dataRules;
   std::vector<unique_ptr<Rule>> m_interestRules;
+
+  /** @brief Indexes of the rules by name prefix, built as the rules are loaded.
+   */
+  RuleIndex m_dataRuleIndex;
+  RuleIndex m_interestRuleIndex;
 };
 
 } // namespace validator_config
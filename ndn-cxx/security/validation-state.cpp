@@ -20,6 +20,8 @@
  */
 
 #include "ndn-cxx/security/validation-state.hpp"
+#include "ndn-cxx/security/public-key-cache.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/security/validator.hpp"
 #include "ndn-cxx/security/verification-helpers.hpp"
 #include "ndn-cxx/util/logger.hpp"
@@ -42,6 +44,9 @@ ValidationState::~ValidationState()
 {
   NDN_LOG_TRACE(__func__);
   BOOST_ASSERT(!boost::logic::indeterminate(m_outcome));
+  // in case fail() did not notify them
+  notifyCoalescedRequests({ValidationError::Code::CANNOT_RETRIEVE_CERT,
+                           "Certificate fetch was abandoned"});
 }
 
 size_t
@@ -83,6 +88,36 @@ ValidationState::verifyCertificateChain(const Certificate& trustedCert)
   return validatedCert;
 }
 
+void
+ValidationState::notifyCoalescedRequests(const ValidationError& error)
+{
+  if (m_coalescedFailureCallback != nullptr) {
+    auto callback = std::move(m_coalescedFailureCallback);
+    m_coalescedFailureCallback = nullptr;
+    callback(error);
+  }
+}
+
+bool
+ValidationState::verifySignature(const Data& data, const Certificate& signer) const
+{
+  if (m_publicKeyCache == nullptr) {
+    return security::verifySignature(data, signer);
+  }
+  auto key = m_publicKeyCache->get(signer);
+  return key != nullptr && security::verifySignature(data, *key);
+}
+
+bool
+ValidationState::verifySignature(const Interest& interest, const Certificate& signer) const
+{
+  if (m_publicKeyCache == nullptr) {
+    return security::verifySignature(interest, signer);
+  }
+  auto key = m_publicKeyCache->get(signer);
+  return key != nullptr && security::verifySignature(interest, *key);
+}
+
 /////// DataValidationState
 
 DataValidationState::DataValidationState(const Data& data,
@@ -107,7 +142,13 @@ DataValidationState::~DataValidationState()
 void
 DataValidationState::verifyOriginalPacket(const Certificate& trustedCert)
 {
-  if (verifySignature(m_data, trustedCert)) {
+  finishVerification(verifySignature(m_data, trustedCert));
+}
+
+void
+DataValidationState::finishVerification(bool isSignatureValid)
+{
+  if (isSignatureValid) {
     NDN_LOG_TRACE_DEPTH("OK signature for data `" << m_data.getName() << "`");
     m_successCb(m_data);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
@@ -135,6 +176,7 @@ DataValidationState::fail(const ValidationError& error)
   m_failureCb(m_data, error);
   BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
   m_outcome = false;
+  this->notifyCoalescedRequests(error);
 }
 
 const Data&
@@ -195,6 +237,7 @@ InterestValidationState::fail(const ValidationError& error)
   m_failureCb(m_interest, error);
   BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
   m_outcome = false;
+  this->notifyCoalescedRequests(error);
 }
 
 const Interest&
@@ -36,6 +36,8 @@ namespace ndn {
 namespace security {
 inline namespace v2 {
 
+class CertificateFetcher;
+class PublicKeyCache;
 class Validator;
 
 /**
@@ -136,12 +138,56 @@ private: // Interface intended to be used only by Validator class
   const Certificate*
   verifyCertificateChain(const Certificate& trustedCert);
 
+protected:
+  /**
+   * @brief Verify signature of @p data using the public key in @p signer
+   *
+   * The parsed public key is taken from the validator's public key cache, if available.
+   */
+  bool
+  verifySignature(const Data& data, const Certificate& signer) const;
+
+  /**
+   * @brief Verify signature of @p interest using the public key in @p signer
+   *
+   * The parsed public key is taken from the validator's public key cache, if available.
+   */
+  bool
+  verifySignature(const Interest& interest, const Certificate& signer) const;
+
+  /**
+   * @brief Notify certificate requests coalesced with a request of this state about the failure
+   *
+   * Implementations of fail() should call this method, so that the coalesced requests fail
+   * without delay. Otherwise, they fail when this state is destroyed, or continue with the next
+   * request for the same certificate.
+   */
+  void
+  notifyCoalescedRequests(const ValidationError& error);
+
 protected:
   boost::logic::tribool m_outcome;
 
 private:
   std::unordered_set<Name> m_seenCertificateNames;
 
+  /**
+   * @brief public key cache of the validator, set by the validator before signature verification
+   */
+  PublicKeyCache* m_publicKeyCache = nullptr;
+
+  /**
+   * @brief if set, receives the trusted signer of the original packet in place of
+   *        verifyOriginalPacket(); used by batch validation
+   */
+  function<void(const Certificate& signer)> m_signerCallback;
+
+  /**
+   * @brief if set, fails the states waiting for a certificate that is being fetched for this
+   *        state; set by CertificateFetcher while the fetch is in progress
+   */
+  function<void(const ValidationError&)> m_coalescedFailureCallback;
+
   /**
    * @brief the certificate chain
    *
@@ -150,6 +196,13 @@ private:
    */
   std::list<v2::Certificate> m_certificateChain;
 
+  /**
+   * @brief the earliest NotAfter time of the trusted certificate and the certificate chain,
+   *        set by the validator before the original packet is verified
+   */
+  time::system_clock::TimePoint m_chainNotAfter = time::system_clock::TimePoint::max();
+
+  friend class CertificateFetcher;
   friend class Validator;
 };
 
@@ -193,10 +246,19 @@ private:
   void
   bypassValidation() final;
 
+  /**
+   * @brief Call the success or failure callback, given the result of signature verification of
+   *        the original packet performed by the validator
+   */
+  void
+  finishVerification(bool isSignatureValid);
+
 private:
   Data m_data;
   DataValidationSuccessCallback m_successCb;
   DataValidationFailureCallback m_failureCb;
+
+  friend class Validator;
 };
 
 /**
@@ -36,31 +36,45 @@ namespace validator_config {
 
 bool
 Filter::match(uint32_t pktType, const Name& pktName, const shared_ptr<ValidationState>& state)
+{
+  auto length = getMatchedNameLength(pktType, pktName, *state);
+  if (!length) {
+    return false;
+  }
+
+  if (*length == pktName.size()) {
+    return matchName(pktName);
+  }
+  return matchName(pktName.getPrefix(*length));
+}
+
+optional<size_t>
+Filter::getMatchedNameLength(uint32_t pktType, const Name& pktName, const ValidationState& state)
 {
   BOOST_ASSERT(pktType == tlv::Interest || pktType == tlv::Data);
 
   if (pktType == tlv::Interest) {
-    auto fmt = state->getTag<SignedInterestFormatTag>();
+    auto fmt = state.getTag<SignedInterestFormatTag>();
     BOOST_ASSERT(fmt);
 
     if (*fmt == SignedInterestFormat::V03) {
       // This check is redundant if parameter digest checking is enabled. However, the parameter
       // digest checking can be disabled in API.
       if (pktName.size() == 0 || pktName[-1].type() != tlv::ParametersSha256DigestComponent) {
-        return false;
+        return nullopt;
       }
 
-      return matchName(pktName.getPrefix(-1));
+      return pktName.size() - 1;
     }
     else {
       if (pktName.size() < signed_interest::MIN_SIZE)
-        return false;
+        return nullopt;
 
-      return matchName(pktName.getPrefix(-signed_interest::MIN_SIZE));
+      return pktName.size() - signed_interest::MIN_SIZE;
     }
   }
   else {
-    return matchName(pktName);
+    return pktName.size();
   }
 }
 
@@ -52,6 +52,19 @@ public:
   bool
   match(uint32_t pktType, const Name& pktName, const shared_ptr<ValidationState>& state);
 
+  /**
+   * @brief Get the number of leading components of @p pktName that filters are matched against
+   *
+   * For signed Interests, the components that carry the signature are excluded.
+   *
+   * @param pktType tlv::Interest or tlv::Data
+   * @param pktName packet name, for signed Interests the last components are not removed
+   * @param state The associated validation state
+   * @return the number of components, or nullopt if no filter can match @p pktName
+   */
+  static optional<size_t>
+  getMatchedNameLength(uint32_t pktType, const Name& pktName, const ValidationState& state);
+
 public:
   /**
    * @brief Create a filter from the configuration section
@@ -95,6 +108,18 @@ class RelationNameFilter : public Filter
 public:
   RelationNameFilter(const Name& name, NameRelation relation);
 
+  const Name&
+  getName() const
+  {
+    return m_name;
+  }
+
+  NameRelation
+  getRelation() const
+  {
+    return m_relation;
+  }
+
 private:
   bool
   matchName(const Name& pktName) override;
@@ -129,6 +154,12 @@ public:
   explicit
   RegexNameFilter(const Regex& regex);
 
+  const Regex&
+  getRegex() const
+  {
+    return m_regex;
+  }
+
 private:
   bool
   matchName(const Name& pktName) override;
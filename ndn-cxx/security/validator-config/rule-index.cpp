@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/validator-config/rule-index.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace validator_config {
+
+void
+RuleIndex::insert(const Rule& rule)
+{
+  size_t position = m_rules.size();
+  m_rules.push_back(&rule);
+
+  if (rule.getFilters().empty()) {
+    return m_unindexed.push_back(position);
+  }
+
+  for (const auto& filter : rule.getFilters()) {
+    if (auto relationFilter = dynamic_cast<const RelationNameFilter*>(filter.get())) {
+      auto& bucket = m_buckets[relationFilter->getName()];
+      switch (relationFilter->getRelation()) {
+        case NameRelation::EQUAL:
+          addPosition(bucket.equal, position);
+          break;
+        case NameRelation::IS_PREFIX_OF:
+          addPosition(bucket.isPrefixOf, position);
+          break;
+        case NameRelation::IS_STRICT_PREFIX_OF:
+          addPosition(bucket.isStrictPrefixOf, position);
+          break;
+      }
+    }
+    else if (auto regexFilter = dynamic_cast<const RegexNameFilter*>(filter.get())) {
+      auto& bucket = m_buckets[getLiteralPrefix(regexFilter->getRegex().getExpr())];
+      addPosition(bucket.isPrefixOf, position);
+    }
+    else {
+      addPosition(m_unindexed, position);
+    }
+  }
+}
+
+void
+RuleIndex::clear()
+{
+  m_rules.clear();
+  m_buckets.clear();
+  m_unindexed.clear();
+}
+
+const Rule*
+RuleIndex::match(uint32_t pktType, const Name& pktName, const shared_ptr<ValidationState>& state) const
+{
+  std::vector<size_t> candidates(m_unindexed);
+
+  auto length = Filter::getMatchedNameLength(pktType, pktName, *state);
+  if (length) {
+    for (size_t prefixLen = 0; prefixLen <= *length; ++prefixLen) {
+      auto it = m_buckets.find(detail::NamePrefix{pktName, prefixLen});
+      if (it == m_buckets.end()) {
+        continue;
+      }
+      const auto& bucket = it->second;
+      candidates.insert(candidates.end(), bucket.isPrefixOf.begin(), bucket.isPrefixOf.end());
+      if (prefixLen < *length) {
+        candidates.insert(candidates.end(), bucket.isStrictPrefixOf.begin(), bucket.isStrictPrefixOf.end());
+      }
+      else {
+        candidates.insert(candidates.end(), bucket.equal.begin(), bucket.equal.end());
+      }
+    }
+  }
+
+  // evaluate candidates in the order the rules were added
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+  for (size_t position : candidates) {
+    if (m_rules[position]->match(pktType, pktName, state)) {
+      return m_rules[position];
+    }
+  }
+  return nullptr;
+}
+
+Name
+RuleIndex::getLiteralPrefix(const std::string& expr)
+{
+  Name prefix;
+  if (expr.empty() || expr[0] != '^') {
+    return prefix;
+  }
+
+  // an alternation or an escape may change the meaning of the leading components
+  if (expr.find_first_of("|\\") != std::string::npos) {
+    return prefix;
+  }
+
+  auto isLiteralChar = [] (char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '~';
+  };
+
+  size_t pos = 1;
+  while (pos < expr.size() && expr[pos] == '<') {
+    size_t end = expr.find('>', pos);
+    if (end == std::string::npos || end == pos + 1 ||
+        !std::all_of(expr.begin() + pos + 1, expr.begin() + end, isLiteralChar)) {
+      break;
+    }
+    // a repeated component may be absent, or occur more than once
+    if (end + 1 < expr.size() && std::strchr("*+?{", expr[end + 1]) != nullptr) {
+      break;
+    }
+    prefix.append(expr.substr(pos + 1, end - pos - 1));
+    pos = end + 1;
+  }
+  return prefix;
+}
+
+void
+RuleIndex::addPosition(std::vector<size_t>& positions, size_t position)
+{
+  // a rule is added to the same list only once, even if several of its filters belong there
+  if (positions.empty() || positions.back() != position) {
+    positions.push_back(position);
+  }
+}
+
+} // namespace validator_config
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
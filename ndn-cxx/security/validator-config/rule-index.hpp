@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_SECURITY_VALIDATOR_CONFIG_RULE_INDEX_HPP
+#define NDN_SECURITY_VALIDATOR_CONFIG_RULE_INDEX_HPP
+
+#include "ndn-cxx/impl/name-index.hpp"
+#include "ndn-cxx/security/validator-config/rule.hpp"
+
+#include <map>
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace validator_config {
+
+/**
+ * @brief Index of the rules of a validation policy, keyed by the name prefixes of their filters
+ *
+ * Rules are indexed when they are added.  A relation filter is indexed under its name, and a
+ * regex filter under the literal name prefix of its expression, i.e., the leading components
+ * that the expression matches exactly.  A lookup only evaluates the rules whose filters are
+ * indexed under a prefix of the packet name, in the order in which the rules were added, so
+ * that the first matching rule is the same as if all rules were evaluated in turn.
+ *
+ * The index does not own the rules, which must outlive it or be removed with clear().
+ */
+class RuleIndex : noncopyable
+{
+public:
+  /**
+   * @brief Add @p rule after all the rules that have been added before
+   */
+  void
+  insert(const Rule& rule);
+
+  /**
+   * @brief Remove all rules
+   */
+  void
+  clear();
+
+  /**
+   * @brief Find the first rule that matches the packet
+   *
+   * @param pktType tlv::Interest or tlv::Data
+   * @param pktName packet name, for signed Interests the last components are not removed
+   * @param state The associated validation state
+   * @return the matched rule, or nullptr if no rule matches
+   */
+  const Rule*
+  match(uint32_t pktType, const Name& pktName, const shared_ptr<ValidationState>& state) const;
+
+  size_t
+  size() const
+  {
+    return m_rules.size();
+  }
+
+  /**
+   * @brief Get the name prefix that every name matched by the regex @p expr starts with
+   *
+   * Only components written as plain strings at the start of an expression anchored with '^'
+   * are included; the prefix is empty if the expression does not start with such components.
+   */
+  static Name
+  getLiteralPrefix(const std::string& expr);
+
+private:
+  /**
+   * @brief positions of the rules whose filters are indexed under a name
+   */
+  struct Bucket
+  {
+    std::vector<size_t> isPrefixOf; ///< filters matching the name and names under it
+    std::vector<size_t> isStrictPrefixOf; ///< filters matching names under the name
+    std::vector<size_t> equal; ///< filters matching only the name
+  };
+
+  static void
+  addPosition(std::vector<size_t>& positions, size_t position);
+
+private:
+  std::vector<const Rule*> m_rules;
+  std::map<Name, Bucket, detail::NamePrefixCompare> m_buckets;
+  std::vector<size_t> m_unindexed; ///< rules that may match any name
+};
+
+} // namespace validator_config
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_SECURITY_VALIDATOR_CONFIG_RULE_INDEX_HPP
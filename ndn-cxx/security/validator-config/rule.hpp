@@ -50,6 +50,12 @@ public:
     return m_pktType;
   }
 
+  const std::vector<unique_ptr<Filter>>&
+  getFilters() const
+  {
+    return m_filters;
+  }
+
   void
   addFilter(unique_ptr<Filter> filter);
 
@@ -22,7 +22,9 @@
 #include "ndn-cxx/security/validator.hpp"
 
 #include "ndn-cxx/face.hpp"
+#include "ndn-cxx/impl/worker-pool.hpp"
 #include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
 namespace ndn {
@@ -76,8 +78,14 @@ Validator::validate(const Data& data,
                     const DataValidationSuccessCallback& successCb,
                     const DataValidationFailureCallback& failureCb)
 {
+  if (isValidatedData(data)) {
+    NDN_LOG_DEBUG("Data " << data.getName() << " has already been validated");
+    return successCb(data);
+  }
+
   auto state = make_shared<DataValidationState>(data, successCb, failureCb);
   NDN_LOG_DEBUG_DEPTH("Start validating data " << data.getName());
+  cacheOnSuccess(*state);
 
   m_policy->checkPolicy(data, state,
       [this] (const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state) {
@@ -131,6 +139,12 @@ Validator::validate(const Certificate& cert, const shared_ptr<ValidationState>&
         state->fail({ValidationError::POLICY_ERROR, "Validation policy is not allowed to designate `" +
                      cert.getName().toUri() + "` as a trust anchor"});
       }
+      else if (isVerifiedCert(cert)) {
+        // the certificate has been verified while this state was waiting for it,
+        // e.g., by a validation that fetched the same certificate
+        NDN_LOG_TRACE_DEPTH("Certificate " << cert.getName() << " has already been verified");
+        verifyWithTrustedCert(cert, state);
+      }
       else {
         // need to fetch key and validate it
         state->addCertificate(cert);
@@ -161,22 +175,229 @@ Validator::requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
   auto cert = findTrustedCert(certRequest->interest);
   if (cert != nullptr) {
     NDN_LOG_TRACE_DEPTH("Found trusted certificate " << cert->getName());
+    verifyWithTrustedCert(*cert, state);
+    return;
+  }
+
+  m_certFetcher->fetch(certRequest, state, [this] (const Certificate& cert, const shared_ptr<ValidationState>& state) {
+      validate(cert, state);
+    });
+}
 
-    cert = state->verifyCertificateChain(*cert);
-    if (cert != nullptr) {
+bool
+Validator::isVerifiedCert(const Certificate& cert) const
+{
+  auto verifiedCert = m_verifiedCertCache.find(cert.getName());
+  return verifiedCert != nullptr && verifiedCert->wireEncode() == cert.wireEncode();
+}
+
+void
+Validator::verifyWithTrustedCert(const Certificate& trustedCert, const shared_ptr<ValidationState>& state)
+{
+  state->m_publicKeyCache = &m_publicKeyCache;
+
+  auto& chain = state->m_certificateChain;
+  state->m_chainNotAfter = trustedCert.getValidityPeriod().getPeriod().second;
+  for (const auto& cert : chain) {
+    state->m_chainNotAfter = std::min(state->m_chainNotAfter, cert.getValidityPeriod().getPeriod().second);
+  }
+
+  // skip the certificates that have already been verified, starting from the trusted end
+  optional<Certificate> verifiedSigner;
+  while (!chain.empty() && isVerifiedCert(chain.front())) {
+    verifiedSigner = std::move(chain.front());
+    chain.pop_front();
+  }
+
+  const Certificate* cert = verifiedSigner ? &*verifiedSigner : &trustedCert;
+  cert = state->verifyCertificateChain(*cert);
+  if (cert != nullptr) {
+    if (state->m_signerCallback != nullptr) {
+      state->m_outcome = true;
+      state->m_signerCallback(*cert);
+    }
+    else {
       state->verifyOriginalPacket(*cert);
     }
-    for (auto trustedCert = std::make_move_iterator(state->m_certificateChain.begin());
-         trustedCert != std::make_move_iterator(state->m_certificateChain.end());
-         ++trustedCert) {
-      cacheVerifiedCertificate(*trustedCert);
+  }
+  for (auto chainCert = std::make_move_iterator(chain.begin());
+       chainCert != std::make_move_iterator(chain.end());
+       ++chainCert) {
+    cacheVerifiedCertificate(*chainCert);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+// Batch validation
+////////////////////////////////////////////////////////////////////////
+
+struct Validator::SignerGroup
+{
+  std::vector<shared_ptr<DataValidationState>> states; ///< states waiting for the signer
+  optional<Certificate> signer; ///< trusted signer, once the certificate chain is verified
+  optional<ValidationError> error; ///< error that prevented verifying the certificate chain
+  time::system_clock::TimePoint chainNotAfter; ///< earliest NotAfter time of the certificate chain
+};
+
+void
+Validator::validate(const std::vector<Data>& batch,
+                    const DataValidationSuccessCallback& successCb,
+                    const DataValidationFailureCallback& failureCb)
+{
+  auto groups = make_shared<SignerGroups>();
+  for (const auto& data : batch) {
+    if (isValidatedData(data)) {
+      NDN_LOG_DEBUG("Data " << data.getName() << " has already been validated");
+      successCb(data);
+      continue;
     }
+
+    auto state = make_shared<DataValidationState>(data, successCb, failureCb);
+    NDN_LOG_DEBUG_DEPTH("Start validating data " << data.getName() << " in a batch");
+    cacheOnSuccess(*state);
+
+    m_policy->checkPolicy(data, state,
+        [this, groups] (const shared_ptr<CertificateRequest>& certRequest, const shared_ptr<ValidationState>& state) {
+        if (certRequest == nullptr) {
+          state->bypassValidation();
+        }
+        else {
+          requestBatchCertificate(groups, certRequest, static_pointer_cast<DataValidationState>(state));
+        }
+      });
+  }
+}
+
+void
+Validator::requestBatchCertificate(const shared_ptr<SignerGroups>& groups,
+                                   const shared_ptr<CertificateRequest>& certRequest,
+                                   const shared_ptr<DataValidationState>& state)
+{
+  const Name& signerName = certRequest->interest.getName();
+  auto& group = (*groups)[signerName];
+  if (group.signer) {
+    return verifyBatch({state}, *group.signer, group.chainNotAfter);
+  }
+  if (group.error) {
+    return state->fail(*group.error);
+  }
+
+  group.states.push_back(state);
+  if (group.states.size() > 1) {
+    // certificate chain is being retrieved for an earlier packet
     return;
   }
 
-  m_certFetcher->fetch(certRequest, state, [this] (const Certificate& cert, const shared_ptr<ValidationState>& state) {
-      validate(cert, state);
+  // Retrieve and verify the certificate chain once for the whole group, using a separate state
+  // for the first packet, whose outcome is propagated to all packets in the group
+  auto chainState = make_shared<DataValidationState>(state->getOriginalData(),
+    [] (const Data&) {},
+    [groups, signerName] (const Data&, const ValidationError& error) {
+      auto& group = (*groups)[signerName];
+      group.error = error;
+      auto states = std::move(group.states);
+      group.states.clear();
+      for (const auto& state : states) {
+        state->fail(error);
+      }
+    });
+  // the callback is invoked by chainState, so it can refer to chainState without owning it
+  chainState->m_signerCallback = [this, groups, signerName, chainState = chainState.get()] (const Certificate& signer) {
+    auto& group = (*groups)[signerName];
+    group.signer = signer;
+    group.chainNotAfter = chainState->m_chainNotAfter;
+    auto states = std::move(group.states);
+    group.states.clear();
+    verifyBatch(states, signer, group.chainNotAfter);
+  };
+
+  requestCertificate(certRequest, chainState);
+}
+
+void
+Validator::verifyBatch(const std::vector<shared_ptr<DataValidationState>>& states,
+                       const Certificate& signer, const time::system_clock::TimePoint& chainNotAfter)
+{
+  for (const auto& state : states) {
+    state->m_chainNotAfter = chainNotAfter;
+  }
+
+  if (m_workers == nullptr) {
+    for (const auto& state : states) {
+      state->m_publicKeyCache = &m_publicKeyCache;
+      state->verifyOriginalPacket(signer);
+    }
+    return;
+  }
+
+  auto key = m_publicKeyCache.get(signer);
+  for (const auto& state : states) {
+    if (key == nullptr) {
+      state->finishVerification(false);
+      continue;
+    }
+
+    // make sure the worker only reads the packet
+    state->getOriginalData().wireEncode().parse();
+
+    m_workers->post([state, key, &io = *m_resultIo] {
+      bool isSignatureValid = verifySignature(state->getOriginalData(), *key);
+      io.post([state, isSignatureValid] { state->finishVerification(isSignatureValid); });
     });
+  }
+}
+
+void
+Validator::setVerificationThreads(boost::asio::io_service& ioService, size_t nThreads)
+{
+  m_workers.reset();
+  m_resultIo = &ioService;
+  if (nThreads > 0) {
+    m_workers = make_unique<detail::WorkerPool>(nThreads);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////
+// Validated Data cache
+////////////////////////////////////////////////////////////////////////
+
+void
+Validator::setValidatedDataCache(size_t capacity, time::nanoseconds maxLifetime)
+{
+  if (capacity == 0) {
+    m_validatedDataCache.reset();
+  }
+  else {
+    m_validatedDataCache = std::make_shared<ValidatedDataCache>(capacity, maxLifetime);
+  }
+}
+
+bool
+Validator::isValidatedData(const Data& data) const
+{
+  // the full name of a packet without wire encoding cannot be computed
+  return m_validatedDataCache != nullptr && data.hasWire() &&
+         m_validatedDataCache->contains(data.getFullName());
+}
+
+void
+Validator::cacheOnSuccess(DataValidationState& state)
+{
+  if (m_validatedDataCache == nullptr) {
+    return;
+  }
+
+  // the callback is invoked by the state, so it can refer to the state without owning it
+  state.m_successCb = [successCb = std::move(state.m_successCb), state = &state,
+                       cache = weak_ptr<ValidatedDataCache>(m_validatedDataCache)] (const Data& data) {
+    auto validatedDataCache = cache.lock();
+    // packets accepted without verification have no certificate chain and are not cached
+    if (validatedDataCache != nullptr && data.hasWire() &&
+        state->m_chainNotAfter != time::system_clock::TimePoint::max()) {
+      validatedDataCache->insert(data.getFullName(), state->m_chainNotAfter);
+    }
+    successCb(data);
+  };
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -202,6 +423,9 @@ void
 Validator::resetAnchors()
 {
   CertificateStorage::resetAnchors();
+  if (m_validatedDataCache != nullptr) {
+    m_validatedDataCache->clear();
+  }
 }
 
 void
@@ -214,6 +438,9 @@ void
 Validator::resetVerifiedCertificates()
 {
   CertificateStorage::resetVerifiedCerts();
+  if (m_validatedDataCache != nullptr) {
+    m_validatedDataCache->clear();
+  }
 }
 
 } // inline namespace v2
@@ -22,17 +22,25 @@
 #ifndef NDN_SECURITY_VALIDATOR_HPP
 #define NDN_SECURITY_VALIDATOR_HPP
 
+#include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/security/certificate-fetcher.hpp"
 #include "ndn-cxx/security/certificate-request.hpp"
 #include "ndn-cxx/security/certificate-storage.hpp"
+#include "ndn-cxx/security/validated-data-cache.hpp"
 #include "ndn-cxx/security/validation-callback.hpp"
 #include "ndn-cxx/security/validation-policy.hpp"
 #include "ndn-cxx/security/validation-state.hpp"
 
+#include <map>
+
 namespace ndn {
 
 class Face;
 
+namespace detail {
+class WorkerPool;
+} // namespace detail
+
 namespace security {
 inline namespace v2 {
 
@@ -53,6 +61,10 @@ inline namespace v2 {
  * A validator has a trust anchor cache to save static and dynamic trust anchors, a verified
  * certificate cache for saving certificates that are already verified and an unverified
  * certificate cache for saving prefetched but not yet verified certificates.
+ * Parsed public keys of trusted certificates are kept in a bounded cache, so that packets
+ * signed by the same key do not require parsing the key again.  Optionally, the full names of
+ * validated Data packets are cached as well, so that duplicates of these packets are accepted
+ * without validation (see setValidatedDataCache()).
  *
  * @todo Limit the maximum time the validation process is allowed to run before declaring failure
  * @todo Ability to customize maximum lifetime for trusted and untrusted certificate caches.
@@ -109,6 +121,57 @@ public:
            const InterestValidationSuccessCallback& successCb,
            const InterestValidationFailureCallback& failureCb);
 
+  /**
+   * @brief Asynchronously validate a batch of Data packets
+   *
+   * Every packet is checked against the validation policy individually.  Packets that require
+   * the same signing certificate are grouped together: the certificate chain is retrieved and
+   * verified once per group, after which the signatures of all packets in the group are verified,
+   * on worker threads if enabled with setVerificationThreads().
+   *
+   * Either @p successCb or @p failureCb is invoked once for every packet in @p batch, in no
+   * particular order.
+   *
+   * @note @p successCb and @p failureCb must not be nullptr
+   */
+  void
+  validate(const std::vector<Data>& batch,
+           const DataValidationSuccessCallback& successCb,
+           const DataValidationFailureCallback& failureCb);
+
+  /**
+   * @brief Verify signatures of batch-validated packets on worker threads
+   *
+   * Pending verifications of a previously configured pool are completed before this method
+   * returns.
+   *
+   * @param ioService io_service through which validation callbacks are invoked after the
+   *                  signatures have been verified, normally the io_service of the Face
+   * @param nThreads  number of worker threads; zero verifies signatures on the calling thread,
+   *                  which is the default
+   */
+  void
+  setVerificationThreads(boost::asio::io_service& ioService, size_t nThreads);
+
+  /**
+   * @brief Enable or disable the cache of validated Data packets
+   *
+   * While the cache is enabled, Data packets whose full name is found in the cache are accepted
+   * without checking the validation policy or verifying any signature.  An entry is kept no longer
+   * than @p maxLifetime, and no longer than any certificate used to validate the packet is valid.
+   * The cache is cleared whenever trust anchors or verified certificates are reset.
+   *
+   * Interest packets are not cached, as the validation policy may need to check every signed
+   * Interest, e.g., to detect replays.
+   *
+   * @param capacity    maximum number of cached packets; zero disables the cache, which is the
+   *                    default
+   * @param maxLifetime maximum time that a packet is kept in the cache
+   */
+  void
+  setValidatedDataCache(size_t capacity,
+                        time::nanoseconds maxLifetime = ValidatedDataCache::getDefaultLifetime());
+
 public: // anchor management
   /**
    * @brief load static trust anchor.
@@ -176,10 +239,62 @@ private: // Common validator operations
   requestCertificate(const shared_ptr<CertificateRequest>& certRequest,
                      const shared_ptr<ValidationState>& state);
 
+  /**
+   * @brief Check whether @p cert is in the verified certificate cache.
+   */
+  bool
+  isVerifiedCert(const Certificate& cert) const;
+
+  /**
+   * @brief Verify the certificate chain of @p state using @p trustedCert, then the original packet.
+   *
+   * Certificates at the front of the chain that are already in the verified certificate cache
+   * are not verified again.
+   */
+  void
+  verifyWithTrustedCert(const Certificate& trustedCert, const shared_ptr<ValidationState>& state);
+
+  /**
+   * @brief Check whether @p data can be accepted from the validated Data cache.
+   */
+  bool
+  isValidatedData(const Data& data) const;
+
+  /**
+   * @brief Arrange for the original packet of @p state to be added to the validated Data cache
+   *        if its validation succeeds
+   */
+  void
+  cacheOnSuccess(DataValidationState& state);
+
+private: // Batch validation
+  struct SignerGroup;
+  using SignerGroups = std::map<Name, SignerGroup>;
+
+  /**
+   * @brief Request the certificate for a packet of a batch, sharing the certificate chain with
+   *        other packets of the batch that are signed by the same key
+   */
+  void
+  requestBatchCertificate(const shared_ptr<SignerGroups>& groups,
+                          const shared_ptr<CertificateRequest>& certRequest,
+                          const shared_ptr<DataValidationState>& state);
+
+  /**
+   * @brief Verify the original packets of @p states, which are signed by trusted @p signer
+   * @param chainNotAfter the earliest NotAfter time of the certificate chain of @p signer
+   */
+  void
+  verifyBatch(const std::vector<shared_ptr<DataValidationState>>& states, const Certificate& signer,
+              const time::system_clock::TimePoint& chainNotAfter);
+
 private:
   unique_ptr<ValidationPolicy> m_policy;
   unique_ptr<CertificateFetcher> m_certFetcher;
   size_t m_maxDepth;
+  boost::asio::io_service* m_resultIo = nullptr;
+  unique_ptr<detail::WorkerPool> m_workers;
+  shared_ptr<ValidatedDataCache> m_validatedDataCache;
 };
 
 } // inline namespace v2
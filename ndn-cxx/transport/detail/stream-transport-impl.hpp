@@ -26,8 +26,7 @@
 
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/write.hpp>
-
-#include <list>
+#include <boost/circular_buffer.hpp>
 
 namespace ndn {
 namespace detail {
@@ -42,12 +41,31 @@ class StreamTransportImpl : public std::enable_shared_from_this<StreamTransportI
 {
 public:
   using Impl = StreamTransportImpl<BaseTransport, Protocol>;
-  using BlockSequence = std::list<Block>;
-  using TransmissionQueue = std::list<BlockSequence>;
+  using TransmissionQueue = boost::circular_buffer<Block>;
+
+  /** \brief Maximum number of blocks written to the socket in one gather write
+   */
+  static constexpr size_t MAX_BATCH_BLOCKS = 64;
+
+  /** \brief Maximum number of bytes written to the socket in one gather write
+   *
+   *  A batch always contains at least one block, even if the block is larger than this limit.
+   */
+  static constexpr size_t MAX_BATCH_BYTES = 8 * MAX_NDN_PACKET_SIZE;
+
+  /** \brief Size of each buffer chunk that received bytes are read into
+   *
+   *  Received elements are delivered as Blocks that refer to the chunk. Reading continues into
+   *  the same chunk until a whole packet might no longer fit, so that partial packets rarely
+   *  need to be relocated.
+   */
+  static constexpr size_t RECEIVE_CHUNK_SIZE = 4 * MAX_NDN_PACKET_SIZE;
 
   StreamTransportImpl(BaseTransport& transport, boost::asio::io_service& ioService)
     : m_transport(transport)
     , m_socket(ioService)
+    , m_inputBuffer(make_shared<Buffer>(RECEIVE_CHUNK_SIZE))
+    , m_transmissionQueue(MAX_BATCH_BLOCKS)
     , m_connectTimer(ioService)
   {
   }
@@ -86,6 +104,7 @@ public:
     m_transport.m_isConnected = false;
     m_transport.m_isReceiving = false;
     m_transmissionQueue.clear();
+    m_nBlocksInFlight = 0;
   }
 
   void
@@ -108,7 +127,11 @@ public:
 
     if (!m_transport.m_isReceiving) {
       m_transport.m_isReceiving = true;
-      m_inputBufferSize = 0;
+      if (m_inputBuffer.use_count() > 1) {
+        // received elements still refer to the current chunk, continue in a fresh one
+        m_inputBuffer = make_shared<Buffer>(RECEIVE_CHUNK_SIZE);
+      }
+      m_frameBegin = m_inputBufferSize = 0;
       asyncReceive();
     }
   }
@@ -116,18 +139,16 @@ public:
   void
   send(const Block& wire)
   {
-    BlockSequence sequence;
-    sequence.push_back(wire);
-    send(std::move(sequence));
+    enqueue(wire);
+    writeIfIdle();
   }
 
   void
   send(const Block& header, const Block& payload)
   {
-    BlockSequence sequence;
-    sequence.push_back(header);
-    sequence.push_back(payload);
-    send(std::move(sequence));
+    enqueue(header);
+    enqueue(payload);
+    writeIfIdle();
   }
 
 protected:
@@ -162,29 +183,59 @@ protected:
   }
 
   void
-  send(BlockSequence&& sequence)
+  enqueue(const Block& block)
   {
-    m_transmissionQueue.emplace_back(sequence);
+    if (m_transmissionQueue.full()) {
+      m_transmissionQueue.set_capacity(2 * m_transmissionQueue.capacity());
+    }
+    m_transmissionQueue.push_back(block);
+
+    auto& counters = m_transport.m_counters;
+    counters.nOutBytes += block.size();
+    counters.maxQueueDepth = std::max(counters.maxQueueDepth, m_transmissionQueue.size());
+  }
 
-    if (m_transport.m_isConnected && m_transmissionQueue.size() == 1) {
+  void
+  writeIfIdle()
+  {
+    if (m_transport.m_isConnected && m_nBlocksInFlight == 0) {
       asyncWrite();
     }
 
-    // if not connected or there is transmission in progress (m_transmissionQueue.size() > 1),
-    // next write will be scheduled either in connectHandler or in asyncWriteHandler
+    // if not connected or there is transmission in progress (m_nBlocksInFlight > 0),
+    // next write will be scheduled either in connectHandler or in handleAsyncWrite
   }
 
+  /** \brief Write a batch of blocks from the front of the transmission queue
+   *
+   *  Blocks queued while a write is in flight are coalesced into the next batch,
+   *  which is submitted to the socket as a single gather write.
+   */
   void
   asyncWrite()
   {
     BOOST_ASSERT(!m_transmissionQueue.empty());
-    boost::asio::async_write(m_socket, m_transmissionQueue.front(),
-                             bind(&Impl::handleAsyncWrite, this->shared_from_this(), _1,
-                                  m_transmissionQueue.begin()));
+    BOOST_ASSERT(m_nBlocksInFlight == 0);
+
+    m_writeBuffers.clear();
+    size_t nBytes = 0;
+    for (const Block& block : m_transmissionQueue) {
+      if (!m_writeBuffers.empty() &&
+          (m_writeBuffers.size() == MAX_BATCH_BLOCKS || nBytes + block.size() > MAX_BATCH_BYTES)) {
+        break;
+      }
+      m_writeBuffers.push_back(block);
+      nBytes += block.size();
+    }
+    m_nBlocksInFlight = m_writeBuffers.size();
+    ++m_transport.m_counters.nWriteBatches;
+
+    boost::asio::async_write(m_socket, m_writeBuffers,
+                             bind(&Impl::handleAsyncWrite, this->shared_from_this(), _1));
   }
 
   void
-  handleAsyncWrite(const boost::system::error_code& error, TransmissionQueue::iterator queueItem)
+  handleAsyncWrite(const boost::system::error_code& error)
   {
     if (error) {
       if (error == boost::system::errc::operation_canceled) {
@@ -199,7 +250,8 @@ protected:
       return; // queue has been already cleared
     }
 
-    m_transmissionQueue.erase(queueItem);
+    m_transmissionQueue.erase_begin(m_nBlocksInFlight);
+    m_nBlocksInFlight = 0;
 
     if (!m_transmissionQueue.empty()) {
       asyncWrite();
@@ -209,8 +261,8 @@ protected:
   void
   asyncReceive()
   {
-    m_socket.async_receive(boost::asio::buffer(m_inputBuffer + m_inputBufferSize,
-                                               MAX_NDN_PACKET_SIZE - m_inputBufferSize), 0,
+    m_socket.async_receive(boost::asio::buffer(m_inputBuffer->data() + m_inputBufferSize,
+                                               m_inputBuffer->size() - m_inputBufferSize), 0,
                            bind(&Impl::handleAsyncReceive, this->shared_from_this(), _1, _2));
   }
 
@@ -227,56 +279,116 @@ protected:
     }
 
     m_inputBufferSize += nBytesRecvd;
-    // do magic
+    m_transport.m_counters.nInBytes += nBytesRecvd;
 
-    std::size_t offset = 0;
-    bool hasProcessedSome = processAllReceived(m_inputBuffer, offset, m_inputBufferSize);
-    if (!hasProcessedSome && m_inputBufferSize == MAX_NDN_PACKET_SIZE && offset == 0) {
-      m_transport.close();
-      NDN_THROW(Transport::Error("input buffer full, but a valid TLV cannot be decoded"));
-    }
-
-    if (offset > 0) {
-      if (offset != m_inputBufferSize) {
-        std::copy(m_inputBuffer + offset, m_inputBuffer + m_inputBufferSize, m_inputBuffer);
-        m_inputBufferSize -= offset;
-      }
-      else {
-        m_inputBufferSize = 0;
-      }
+    processAllReceived();
+    if (m_frameBegin < m_inputBufferSize) {
+      ++m_transport.m_counters.nPartialFrameStalls;
     }
 
+    prepareInputBuffer();
     asyncReceive();
   }
 
-  bool
-  processAllReceived(uint8_t* buffer, size_t& offset, size_t nBytesAvailable)
+  /** \brief Deliver all complete TLV elements received since the last call
+   *
+   *  Frame boundaries are located in a single pass with tlv::indexElements(), which reads only
+   *  TLV-TYPE and TLV-LENGTH. Each element is delivered as a Block that refers to the input
+   *  chunk, so that no copy is made between the socket and the receive callback.
+   *
+   *  \throw Transport::Error an element is larger than MAX_NDN_PACKET_SIZE; the elements
+   *                          preceding it have been delivered and the transport is closed
+   */
+  void
+  processAllReceived()
   {
-    while (offset < nBytesAvailable) {
-      bool isOk = false;
-      Block element;
-      std::tie(isOk, element) = Block::fromBuffer(buffer + offset, nBytesAvailable - offset);
-      if (!isOk)
-        return false;
+    m_inputIndex.clear();
+    size_t nIndexed = tlv::indexElements(m_inputBuffer->data() + m_frameBegin,
+                                         m_inputBufferSize - m_frameBegin,
+                                         std::back_inserter(m_inputIndex));
+
+    const auto base = m_inputBuffer->cbegin() + m_frameBegin;
+    m_frameBegin += nIndexed;
+
+    for (const auto& entry : m_inputIndex) {
+      if (entry.end - entry.begin > MAX_NDN_PACKET_SIZE) {
+        m_transport.close();
+        NDN_THROW(Transport::Error("received TLV element exceeds MAX_NDN_PACKET_SIZE"));
+      }
 
+      ++m_transport.m_counters.nInFrames;
+      Block element(m_inputBuffer, entry.type, base + entry.begin, base + entry.end,
+                    base + entry.valueBegin, base + entry.end);
       m_transport.m_receiveCallback(element);
-      offset += element.size();
     }
-    return true;
+  }
+
+  /** \brief Make sure the input chunk has room for the rest of a packet starting at m_frameBegin
+   *
+   *  The partial packet at the end of the input, if any, stays in place as long as a packet of
+   *  maximum size starting there would fit in the chunk. Otherwise, it is copied to the beginning
+   *  of a chunk, which happens at most once per RECEIVE_CHUNK_SIZE - MAX_NDN_PACKET_SIZE
+   *  received bytes.
+   */
+  void
+  prepareInputBuffer()
+  {
+    size_t nPending = m_inputBufferSize - m_frameBegin;
+    if (nPending >= MAX_NDN_PACKET_SIZE) {
+      m_transport.close();
+      NDN_THROW(Transport::Error("input buffer full, but a valid TLV cannot be decoded"));
+    }
+
+    bool isShared = m_inputBuffer.use_count() > 1;
+    if (nPending == 0 && !isShared) {
+      // no received element refers to the chunk, start over from its beginning
+      m_frameBegin = m_inputBufferSize = 0;
+      return;
+    }
+
+    if (m_frameBegin + MAX_NDN_PACKET_SIZE <= RECEIVE_CHUNK_SIZE) {
+      return;
+    }
+
+    if (isShared) {
+      // received elements still refer to the current chunk, continue in a fresh one
+      auto newBuffer = make_shared<Buffer>(RECEIVE_CHUNK_SIZE);
+      std::copy_n(m_inputBuffer->begin() + m_frameBegin, nPending, newBuffer->begin());
+      m_inputBuffer = std::move(newBuffer);
+    }
+    else {
+      std::copy_n(m_inputBuffer->begin() + m_frameBegin, nPending, m_inputBuffer->begin());
+    }
+    m_frameBegin = 0;
+    m_inputBufferSize = nPending;
+    ++m_transport.m_counters.nInChunkRelocations;
   }
 
 protected:
   BaseTransport& m_transport;
 
   typename Protocol::socket m_socket;
-  uint8_t m_inputBuffer[MAX_NDN_PACKET_SIZE];
-  size_t m_inputBufferSize = 0;
+  shared_ptr<Buffer> m_inputBuffer;
+  size_t m_frameBegin = 0; ///< position in m_inputBuffer of the first byte not yet delivered
+  size_t m_inputBufferSize = 0; ///< position in m_inputBuffer just past the last received byte
+  std::vector<tlv::ElementIndexEntry> m_inputIndex; ///< reused by processAllReceived()
 
   TransmissionQueue m_transmissionQueue;
+  std::vector<boost::asio::const_buffer> m_writeBuffers;
+  size_t m_nBlocksInFlight = 0; ///< number of blocks at the front of the queue being written
   boost::asio::steady_timer m_connectTimer;
   bool m_isConnecting = false;
 };
 
+template<typename BaseTransport, typename Protocol>
+constexpr size_t StreamTransportImpl<BaseTransport, Protocol>::MAX_BATCH_BLOCKS;
+
+template<typename BaseTransport, typename Protocol>
+constexpr size_t StreamTransportImpl<BaseTransport, Protocol>::MAX_BATCH_BYTES;
+
+template<typename BaseTransport, typename Protocol>
+constexpr size_t StreamTransportImpl<BaseTransport, Protocol>::RECEIVE_CHUNK_SIZE;
+
 } // namespace detail
 } // namespace ndn
 
@@ -46,6 +46,23 @@ public:
   using ReceiveCallback = std::function<void(const Block& wire)>;
   using ErrorCallback = std::function<void()>;
 
+  /** \brief Transport statistics
+   */
+  struct Counters
+  {
+    uint64_t nOutBytes = 0;      ///< total size of blocks submitted for sending
+    uint64_t nWriteBatches = 0;  ///< number of (gather) write operations issued to the socket
+    size_t maxQueueDepth = 0;    ///< highest number of blocks waiting in the transmission queue
+
+    uint64_t nInBytes = 0;       ///< total number of bytes received from the socket
+    uint64_t nInFrames = 0;      ///< number of TLV elements delivered to the receive callback
+    /** \brief number of reads that ended in the middle of a TLV element, whose delivery
+     *         then had to wait for another read
+     */
+    uint64_t nPartialFrameStalls = 0;
+    uint64_t nInChunkRelocations = 0; ///< number of times a partial element was copied in the input buffer
+  };
+
   virtual
   ~Transport() = default;
 
@@ -109,11 +126,18 @@ public:
     return m_isReceiving;
   }
 
+  const Counters&
+  getCounters() const noexcept
+  {
+    return m_counters;
+  }
+
 protected:
   boost::asio::io_service* m_ioService = nullptr;
   ReceiveCallback m_receiveCallback;
   bool m_isConnected = false;
   bool m_isReceiving = false;
+  Counters m_counters;
 };
 
 } // namespace ndn
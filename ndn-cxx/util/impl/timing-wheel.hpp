@@ -0,0 +1,352 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_UTIL_IMPL_TIMING_WHEEL_HPP
+#define NDN_UTIL_IMPL_TIMING_WHEEL_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <array>
+
+namespace ndn {
+namespace util {
+namespace detail {
+
+/** \brief Hashed hierarchical timing wheel.
+ *  \tparam T type of the items stored in the wheel; must be default-constructible and movable
+ *
+ *  Time is measured in ticks. Items due within the next 256 ticks are kept in the first level,
+ *  one slot per tick; items due later are kept in coarser levels and are cascaded into finer
+ *  levels as the wheel turns. Inserting and erasing an item are O(1), and nodes are recycled
+ *  through a free list so that steady-state operation does not allocate.
+ */
+template<typename T>
+class TimingWheel : noncopyable
+{
+private:
+  static constexpr size_t SLOT_BITS = 8;
+  static constexpr size_t N_SLOTS = size_t(1) << SLOT_BITS;
+  static constexpr uint64_t SLOT_MASK = N_SLOTS - 1;
+  static constexpr size_t N_LEVELS = 4;
+  static constexpr size_t NODES_PER_CHUNK = 1024;
+
+public:
+  class Node
+  {
+  private:
+    T m_value;
+    uint64_t m_tick = 0;
+    Node* m_prev = nullptr;
+    Node* m_next = nullptr;
+    uint8_t m_level = 0;
+    uint8_t m_slot = 0;
+
+    friend TimingWheel;
+  };
+
+  TimingWheel() = default;
+
+  /** \brief Insert an item that is due at \p tick.
+   *
+   *  An item due at a tick that has already been processed is due at the next processed tick.
+   *  \return handle to erase the item; it is valid until the item is erased or popped
+   */
+  Node*
+  insert(uint64_t tick, T value)
+  {
+    Node* node = allocate();
+    node->m_value = std::move(value);
+    node->m_tick = std::max(tick, m_current);
+    link(node);
+    ++m_size;
+    return node;
+  }
+
+  /** \brief Erase an item that has not been popped.
+   *  \return the erased item
+   */
+  T
+  erase(Node* node)
+  {
+    unlink(node);
+    --m_size;
+    T value = std::move(node->m_value);
+    release(node);
+    return value;
+  }
+
+  /** \brief Pop an item that is due at or before \p now.
+   *  \retval true an item was moved into \p value
+   *  \retval false no item is due
+   *
+   *  Items due at the same tick are popped in an unspecified order.
+   */
+  bool
+  pop(uint64_t now, T& value)
+  {
+    while (m_current <= now) {
+      if (m_size == 0) {
+        m_current = now + 1;
+        return false;
+      }
+
+      size_t slot = m_current & SLOT_MASK;
+      Node* node = m_slots[0][slot];
+      if (node != nullptr) {
+        value = erase(node);
+        return true;
+      }
+
+      // skip to the next non-empty slot of the first level, or to the next cascade
+      uint64_t base = m_current & ~SLOT_MASK;
+      uint64_t next = base + findNextSlot(0, slot + 1).value_or(N_SLOTS);
+      m_current = std::min(next, now + 1);
+      if (m_current == base + N_SLOTS) {
+        cascade();
+      }
+    }
+    return false;
+  }
+
+  /** \brief Return the earliest tick at which pop() may return an item.
+   *
+   *  The returned tick is not later than the earliest due item, but may be earlier if items
+   *  need to be cascaded at that tick.
+   */
+  optional<uint64_t>
+  getNextTick() const
+  {
+    if (m_size == 0) {
+      return nullopt;
+    }
+
+    uint64_t next = std::numeric_limits<uint64_t>::max();
+    for (size_t level = 0; level < N_LEVELS; ++level) {
+      size_t shift = level * SLOT_BITS;
+      size_t current = (m_current >> shift) & SLOT_MASK;
+      // on the first level, the current slot holds items due now;
+      // on coarser levels, it holds items due in the next turn of that level
+      size_t first = level == 0 ? current : current + 1;
+      auto found = findNextSlot(level, first);
+      size_t distance = 0;
+      if (found) {
+        distance = *found - current;
+      }
+      else if ((found = findNextSlot(level, 0))) {
+        distance = *found + N_SLOTS - current;
+      }
+      else {
+        continue;
+      }
+
+      uint64_t tick = level == 0 ? m_current + distance :
+                      ((m_current >> shift) + distance) << shift;
+      next = std::min(next, tick);
+    }
+    return next;
+  }
+
+  /** \brief Erase all items.
+   */
+  void
+  clear()
+  {
+    for (auto& level : m_slots) {
+      for (Node*& head : level) {
+        while (head != nullptr) {
+          Node* node = head;
+          head = node->m_next;
+          node->m_value = T();
+          release(node);
+        }
+      }
+    }
+    for (auto& bitmap : m_bitmaps) {
+      bitmap.fill(0);
+    }
+    m_size = 0;
+  }
+
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  NDN_CXX_NODISCARD bool
+  empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+private:
+  Node*
+  allocate()
+  {
+    if (m_freeList == nullptr) {
+      m_chunks.push_back(make_unique<Node[]>(NODES_PER_CHUNK));
+      Node* chunk = m_chunks.back().get();
+      for (size_t i = 0; i < NODES_PER_CHUNK; ++i) {
+        chunk[i].m_next = m_freeList;
+        m_freeList = &chunk[i];
+      }
+    }
+
+    Node* node = m_freeList;
+    m_freeList = node->m_next;
+    return node;
+  }
+
+  void
+  release(Node* node)
+  {
+    node->m_prev = nullptr;
+    node->m_next = m_freeList;
+    m_freeList = node;
+  }
+
+  void
+  link(Node* node)
+  {
+    uint64_t delta = node->m_tick - m_current;
+    uint64_t tick = node->m_tick;
+    size_t level = 0;
+    while (level < N_LEVELS - 1 && delta >= (uint64_t(1) << ((level + 1) * SLOT_BITS))) {
+      ++level;
+    }
+    if (level == N_LEVELS - 1) {
+      // items beyond the span of the wheel wait in the last slot it can address
+      uint64_t span = (uint64_t(1) << (N_LEVELS * SLOT_BITS)) - 1;
+      tick = m_current + std::min(delta, span);
+    }
+
+    size_t slot = (tick >> (level * SLOT_BITS)) & SLOT_MASK;
+    Node*& head = m_slots[level][slot];
+    node->m_level = static_cast<uint8_t>(level);
+    node->m_slot = static_cast<uint8_t>(slot);
+    node->m_prev = nullptr;
+    node->m_next = head;
+    if (head != nullptr) {
+      head->m_prev = node;
+    }
+    head = node;
+    m_bitmaps[level][slot / 64] |= uint64_t(1) << (slot % 64);
+  }
+
+  void
+  unlink(Node* node)
+  {
+    Node*& head = m_slots[node->m_level][node->m_slot];
+    if (node->m_prev != nullptr) {
+      node->m_prev->m_next = node->m_next;
+    }
+    else {
+      head = node->m_next;
+    }
+    if (node->m_next != nullptr) {
+      node->m_next->m_prev = node->m_prev;
+    }
+    if (head == nullptr) {
+      m_bitmaps[node->m_level][node->m_slot / 64] &= ~(uint64_t(1) << (node->m_slot % 64));
+    }
+  }
+
+  /** \brief Move the items of coarser levels that become due within the next turn of the
+   *         first level, after m_current has moved to the beginning of that turn.
+   */
+  void
+  cascade()
+  {
+    for (size_t level = 1; level < N_LEVELS; ++level) {
+      size_t slot = (m_current >> (level * SLOT_BITS)) & SLOT_MASK;
+      Node* node = m_slots[level][slot];
+      m_slots[level][slot] = nullptr;
+      m_bitmaps[level][slot / 64] &= ~(uint64_t(1) << (slot % 64));
+      while (node != nullptr) {
+        Node* next = node->m_next;
+        link(node);
+        node = next;
+      }
+
+      if (slot != 0) {
+        break;
+      }
+    }
+  }
+
+  /** \brief Find the first non-empty slot of \p level at or after \p first.
+   */
+  optional<size_t>
+  findNextSlot(size_t level, size_t first) const
+  {
+    for (size_t word = first / 64; word < m_bitmaps[level].size(); ++word) {
+      uint64_t bits = m_bitmaps[level][word];
+      if (word == first / 64) {
+        bits &= ~uint64_t(0) << (first % 64);
+      }
+      if (bits != 0) {
+        return word * 64 + countTrailingZeros(bits);
+      }
+    }
+    return nullopt;
+  }
+
+  static size_t
+  countTrailingZeros(uint64_t bits)
+  {
+    size_t n = 0;
+    while ((bits & 1) == 0) {
+      bits >>= 1;
+      ++n;
+    }
+    return n;
+  }
+
+private:
+  std::array<std::array<Node*, N_SLOTS>, N_LEVELS> m_slots{};
+  std::array<std::array<uint64_t, N_SLOTS / 64>, N_LEVELS> m_bitmaps{};
+  uint64_t m_current = 0; ///< the next tick to be processed
+  size_t m_size = 0;
+
+  std::vector<unique_ptr<Node[]>> m_chunks;
+  Node* m_freeList = nullptr;
+};
+
+template<typename T>
+constexpr size_t TimingWheel<T>::SLOT_BITS;
+
+template<typename T>
+constexpr size_t TimingWheel<T>::N_SLOTS;
+
+template<typename T>
+constexpr uint64_t TimingWheel<T>::SLOT_MASK;
+
+template<typename T>
+constexpr size_t TimingWheel<T>::N_LEVELS;
+
+template<typename T>
+constexpr size_t TimingWheel<T>::NODES_PER_CHUNK;
+
+} // namespace detail
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_UTIL_IMPL_TIMING_WHEEL_HPP
@@ -21,45 +21,44 @@
 
 #include "ndn-cxx/util/scheduler.hpp"
 #include "ndn-cxx/util/impl/steady-timer.hpp"
+#include "ndn-cxx/util/impl/timing-wheel.hpp"
 #include "ndn-cxx/util/scope.hpp"
 
 namespace ndn {
 namespace scheduler {
 
 /** \brief Stores internal information about a scheduled event
+ *
+ *  Event records are pooled by the Scheduler and reused after the event expires or is canceled.
  */
 class EventInfo : noncopyable
 {
-public:
-  EventInfo(time::nanoseconds after, EventCallback&& cb)
-    : callback(std::move(cb))
-    , expireTime(time::steady_clock::now() + after)
-  {
-  }
-
-  NDN_CXX_NODISCARD time::nanoseconds
-  expiresFromNow() const
-  {
-    return std::max(expireTime - time::steady_clock::now(), 0_ns);
-  }
-
 public:
   EventCallback callback;
-  Scheduler::EventQueue::const_iterator queueIt;
   time::steady_clock::TimePoint expireTime;
-  bool isExpired = false;
+  uint64_t sequence = 0; ///< with Backend::PRIORITY_QUEUE, orders events with the same expireTime
+  size_t heapPos = 0; ///< with Backend::PRIORITY_QUEUE, position in Scheduler::m_heap
+  Scheduler::EventWheel::Node* wheelNode = nullptr; ///< with Backend::TIMING_WHEEL
+  uint64_t generation = 0; ///< incremented each time the record is released
+  uint32_t nextFree = 0;
 };
 
-EventId::EventId(Scheduler& sched, weak_ptr<EventInfo> info)
-  : CancelHandle([&sched, info] { sched.cancelImpl(info.lock()); })
-  , m_info(std::move(info))
+static const uint32_t EVENTS_PER_CHUNK = 128;
+static const uint32_t NO_EVENT = std::numeric_limits<uint32_t>::max();
+
+void
+EventId::cancel() const
 {
+  auto sched = m_scheduler.lock();
+  if (sched != nullptr) {
+    (*sched)->cancelImpl(m_slot, m_generation);
+  }
 }
 
 EventId::operator bool() const noexcept
 {
-  auto sp = m_info.lock();
-  return sp != nullptr && !sp->isExpired;
+  auto sched = m_scheduler.lock();
+  return sched != nullptr && (*sched)->isPending(m_slot, m_generation);
 }
 
 void
@@ -71,72 +70,307 @@ EventId::reset() noexcept
 std::ostream&
 operator<<(std::ostream& os, const EventId& eventId)
 {
-  return os << eventId.m_info.lock();
+  if (!eventId) {
+    return os << static_cast<const void*>(nullptr);
+  }
+  return os << *eventId.m_scheduler.lock() << ':' << eventId.m_slot << ':' << eventId.m_generation;
 }
 
-bool
-Scheduler::EventQueueCompare::operator()(const shared_ptr<EventInfo>& a,
-                                         const shared_ptr<EventInfo>& b) const noexcept
+static const time::nanoseconds WHEEL_TICK = 1_ms;
+
+/** \brief Return the first wheel tick that starts at or after \p t
+ */
+static uint64_t
+getTickAfter(time::steady_clock::TimePoint epoch, time::steady_clock::TimePoint t)
+{
+  auto d = t - epoch;
+  if (d <= 0_ns) {
+    return 0;
+  }
+  return static_cast<uint64_t>((d.count() + WHEEL_TICK.count() - 1) / WHEEL_TICK.count());
+}
+
+/** \brief Return the wheel tick that contains \p t
+ */
+static uint64_t
+getTickOf(time::steady_clock::TimePoint epoch, time::steady_clock::TimePoint t)
+{
+  return static_cast<uint64_t>(std::max(t - epoch, 0_ns).count() / WHEEL_TICK.count());
+}
+
+/** \brief Return the time point at which wheel tick \p tick starts
+ */
+static time::steady_clock::TimePoint
+getTickStart(time::steady_clock::TimePoint epoch, uint64_t tick)
 {
-  return a->expireTime < b->expireTime;
+  return epoch + static_cast<time::nanoseconds::rep>(tick) * WHEEL_TICK;
 }
 
-Scheduler::Scheduler(boost::asio::io_service& ioService)
-  : m_timer(make_unique<util::detail::SteadyTimer>(ioService))
+Scheduler::Scheduler(boost::asio::io_service& ioService, Backend backend)
+  : m_freeEvents(NO_EVENT)
+  , m_timer(make_unique<util::detail::SteadyTimer>(ioService))
+  , m_self(make_shared<Scheduler*>(this))
 {
+  if (backend == Backend::TIMING_WHEEL) {
+    m_wheel = make_unique<EventWheel>();
+    m_wheelEpoch = time::steady_clock::now();
+  }
 }
 
-Scheduler::~Scheduler() = default;
+Scheduler::~Scheduler()
+{
+  // release the events while the pool is intact, in case a callback's destructor cancels an event
+  cancelAllEvents();
+  m_self.reset();
+}
 
 EventId
 Scheduler::schedule(time::nanoseconds after, EventCallback callback)
 {
   BOOST_ASSERT(callback != nullptr);
 
-  auto i = m_queue.insert(std::make_shared<EventInfo>(after, std::move(callback)));
-  (*i)->queueIt = i;
+  uint32_t slot = allocateEvent();
+  EventInfo& info = getEvent(slot);
+  info.callback = std::move(callback);
+  info.expireTime = time::steady_clock::now() + after;
 
-  if (!m_isEventExecuting && i == m_queue.begin()) {
-    // the new event is the first one to expire
-    scheduleNext();
+  if (m_wheel != nullptr) {
+    uint64_t tick = getTickAfter(m_wheelEpoch, info.expireTime);
+    info.wheelNode = m_wheel->insert(tick, slot);
+    if (!m_isEventExecuting) {
+      armTimer(getTickStart(m_wheelEpoch, tick));
+    }
+  }
+  else {
+    info.sequence = m_nextSequence++;
+    pushHeap(slot);
+    if (!m_isEventExecuting && m_heap.front() == slot) {
+      // the new event is the first one to expire
+      armTimer(info.expireTime);
+    }
+  }
+
+  return EventId(m_self, slot, info.generation);
+}
+
+uint32_t
+Scheduler::allocateEvent()
+{
+  if (m_freeEvents == NO_EVENT) {
+    auto first = static_cast<uint32_t>(m_events.size() * EVENTS_PER_CHUNK);
+    m_events.push_back(make_unique<EventInfo[]>(EVENTS_PER_CHUNK));
+    for (uint32_t i = EVENTS_PER_CHUNK; i-- > 0;) {
+      m_events.back()[i].nextFree = m_freeEvents;
+      m_freeEvents = first + i;
+    }
   }
 
-  return EventId(*this, *i);
+  uint32_t slot = m_freeEvents;
+  m_freeEvents = getEvent(slot).nextFree;
+  return slot;
+}
+
+EventCallback
+Scheduler::releaseEvent(uint32_t slot)
+{
+  EventInfo& info = getEvent(slot);
+  EventCallback callback = std::move(info.callback);
+  info.callback = nullptr;
+  info.wheelNode = nullptr;
+  ++info.generation;
+  info.nextFree = m_freeEvents;
+  m_freeEvents = slot;
+  return callback;
+}
+
+EventInfo&
+Scheduler::getEvent(uint32_t slot) const
+{
+  return m_events[slot / EVENTS_PER_CHUNK][slot % EVENTS_PER_CHUNK];
+}
+
+bool
+Scheduler::isPending(uint32_t slot, uint64_t generation) const noexcept
+{
+  if (slot >= m_events.size() * EVENTS_PER_CHUNK) {
+    return false;
+  }
+  const EventInfo& info = getEvent(slot);
+  // an unused record has no callback
+  return info.generation == generation && info.callback != nullptr;
 }
 
 void
-Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
+Scheduler::cancelImpl(uint32_t slot, uint64_t generation)
 {
-  if (info == nullptr || info->isExpired) {
+  if (!isPending(slot, generation)) {
     return;
   }
 
-  if (info->queueIt == m_queue.begin()) {
-    m_timer->cancel();
+  // The timer is left waiting even if it was waiting for this event: it then expires without
+  // executing any event and is set again for the next event. This avoids resetting the timer
+  // each time the earliest event is canceled, which is the common case for Interest timeouts.
+  bool isEmpty = false;
+  if (m_wheel != nullptr) {
+    m_wheel->erase(getEvent(slot).wheelNode);
+    isEmpty = m_wheel->empty();
   }
-  m_queue.erase(info->queueIt);
+  else {
+    eraseHeap(getEvent(slot).heapPos);
+    isEmpty = m_heap.empty();
+  }
+  EventCallback callback = releaseEvent(slot);
 
-  if (!m_isEventExecuting) {
-    scheduleNext();
+  if (isEmpty) {
+    // do not keep the io_service busy without events
+    cancelTimer();
   }
+  // the callback is destroyed last, in case its destructor cancels another event
 }
 
 void
 Scheduler::cancelAllEvents()
 {
-  m_queue.clear();
-  m_timer->cancel();
+  std::vector<uint32_t> slots;
+  if (m_wheel != nullptr) {
+    for (uint32_t slot = 0; slot < m_events.size() * EVENTS_PER_CHUNK; ++slot) {
+      if (getEvent(slot).wheelNode != nullptr) {
+        slots.push_back(slot);
+      }
+    }
+    m_wheel->clear();
+  }
+  else {
+    slots.swap(m_heap);
+  }
+
+  // Release all records before destroying any callback: the destructor of a callback may cancel
+  // another event, which then has no effect.
+  std::vector<EventCallback> callbacks;
+  callbacks.reserve(slots.size());
+  for (uint32_t slot : slots) {
+    callbacks.push_back(releaseEvent(slot));
+  }
+  cancelTimer();
+}
+
+void
+Scheduler::pushHeap(uint32_t slot)
+{
+  getEvent(slot).heapPos = m_heap.size();
+  m_heap.push_back(slot);
+  siftUp(m_heap.size() - 1);
+}
+
+void
+Scheduler::eraseHeap(size_t pos)
+{
+  uint32_t last = m_heap.back();
+  m_heap.pop_back();
+  if (pos < m_heap.size()) {
+    m_heap[pos] = last;
+    getEvent(last).heapPos = pos;
+    siftUp(pos);
+    siftDown(getEvent(last).heapPos);
+  }
+}
+
+void
+Scheduler::siftUp(size_t pos)
+{
+  uint32_t slot = m_heap[pos];
+  while (pos > 0) {
+    size_t parent = (pos - 1) / 2;
+    if (!isEarlier(slot, m_heap[parent])) {
+      break;
+    }
+    m_heap[pos] = m_heap[parent];
+    getEvent(m_heap[pos]).heapPos = pos;
+    pos = parent;
+  }
+  m_heap[pos] = slot;
+  getEvent(slot).heapPos = pos;
+}
+
+void
+Scheduler::siftDown(size_t pos)
+{
+  uint32_t slot = m_heap[pos];
+  while (true) {
+    size_t child = 2 * pos + 1;
+    if (child >= m_heap.size()) {
+      break;
+    }
+    if (child + 1 < m_heap.size() && isEarlier(m_heap[child + 1], m_heap[child])) {
+      ++child;
+    }
+    if (!isEarlier(m_heap[child], slot)) {
+      break;
+    }
+    m_heap[pos] = m_heap[child];
+    getEvent(m_heap[pos]).heapPos = pos;
+    pos = child;
+  }
+  m_heap[pos] = slot;
+  getEvent(slot).heapPos = pos;
+}
+
+bool
+Scheduler::isEarlier(uint32_t a, uint32_t b) const
+{
+  const EventInfo& x = getEvent(a);
+  const EventInfo& y = getEvent(b);
+  return x.expireTime < y.expireTime ||
+         (x.expireTime == y.expireTime && x.sequence < y.sequence);
+}
+
+void
+Scheduler::setTimerSlack(time::nanoseconds slack)
+{
+  BOOST_ASSERT(slack >= 0_ns);
+  m_timerSlack = slack;
 }
 
 void
 Scheduler::scheduleNext()
 {
-  if (!m_queue.empty()) {
-    m_timer->expires_from_now((*m_queue.begin())->expiresFromNow());
-    m_timer->async_wait([this] (const auto& error) { this->executeEvent(error); });
+  if (m_wheel != nullptr) {
+    auto tick = m_wheel->getNextTick();
+    if (tick) {
+      armTimer(getTickStart(m_wheelEpoch, *tick));
+    }
+  }
+  else if (!m_heap.empty()) {
+    armTimer(getEvent(m_heap.front()).expireTime);
   }
 }
 
+void
+Scheduler::armTimer(time::steady_clock::TimePoint expiry)
+{
+  if (m_isTimerArmed && m_timerExpiry <= expiry + m_timerSlack) {
+    return;
+  }
+
+  m_timerExpiry = expiry + m_timerSlack;
+  m_isTimerArmed = true;
+  ++m_timerCounters.nArms;
+  m_timer->expires_from_now(std::max(m_timerExpiry - time::steady_clock::now(), 0_ns));
+  m_timer->async_wait([this] (const auto& error) { this->executeEvent(error); });
+}
+
+void
+Scheduler::cancelTimer()
+{
+  if (!m_isTimerArmed) {
+    return;
+  }
+
+  m_isTimerArmed = false;
+  ++m_timerCounters.nCancels;
+  m_timer->cancel();
+}
+
 void
 Scheduler::executeEvent(const boost::system::error_code& error)
 {
@@ -144,7 +378,14 @@ Scheduler::executeEvent(const boost::system::error_code& error)
     return;
   }
 
-  auto guard = make_scope_exit([this] {
+  m_isTimerArmed = false;
+  ++m_timerCounters.nWakeups;
+
+  bool hasExecuted = false;
+  auto guard = make_scope_exit([this, &hasExecuted] {
+    if (!hasExecuted) {
+      ++m_timerCounters.nEmptyWakeups;
+    }
     m_isEventExecuting = false;
     scheduleNext();
   });
@@ -152,16 +393,26 @@ Scheduler::executeEvent(const boost::system::error_code& error)
 
   // process all expired events
   auto now = time::steady_clock::now();
-  while (!m_queue.empty()) {
-    auto head = m_queue.begin();
-    shared_ptr<EventInfo> info = *head;
-    if (info->expireTime > now) {
-      break;
+  while (true) {
+    uint32_t slot = NO_EVENT;
+    if (m_wheel != nullptr) {
+      if (!m_wheel->pop(getTickOf(m_wheelEpoch, now), slot)) {
+        break;
+      }
+    }
+    else {
+      if (m_heap.empty() || getEvent(m_heap.front()).expireTime > now) {
+        break;
+      }
+      slot = m_heap.front();
+      eraseHeap(0);
     }
 
-    m_queue.erase(head);
-    info->isExpired = true;
-    info->callback();
+    // the event is released before its callback is invoked, so that its EventId is invalid
+    // during the callback
+    EventCallback callback = releaseEvent(slot);
+    hasExecuted = true;
+    callback();
   }
 }
 
@@ -27,13 +27,14 @@
 #include "ndn-cxx/util/time.hpp"
 
 #include <boost/system/error_code.hpp>
-#include <set>
+#include <vector>
 
 namespace ndn {
 
 namespace util {
 namespace detail {
 class SteadyTimer;
+template<typename T> class TimingWheel;
 } // namespace detail
 } // namespace util
 
@@ -53,17 +54,25 @@ using EventCallback = std::function<void()>;
  *  eid.cancel(); // cancel the event
  *  \endcode
  *
- *  \note Canceling an expired (executed) or canceled event has no effect.
- *  \warning Canceling an event after the scheduler has been destructed may trigger undefined
- *           behavior.
+ *  An EventId identifies an event by its slot in the scheduler's event pool and the generation
+ *  of that slot, which changes whenever the event expires or is canceled. Therefore, copying
+ *  and canceling an EventId do not allocate memory.
+ *
+ *  \note Canceling an expired (executed) or canceled event has no effect. After the scheduler
+ *        has been destructed, an EventId behaves as if its event were canceled.
  */
-class EventId : public detail::CancelHandle
+class EventId
 {
 public:
   /** \brief Constructs an empty EventId
    */
   EventId() noexcept = default;
 
+  /** \brief Cancel the event.
+   */
+  void
+  cancel() const;
+
   /** \brief Determine whether the event is valid.
    *  \retval true The event is valid.
    *  \retval false This EventId is empty, or the event is expired or cancelled.
@@ -88,8 +97,10 @@ private:
   operator==(const EventId& lhs, const EventId& rhs) noexcept
   {
     return (!lhs && !rhs) ||
-        (!lhs.m_info.owner_before(rhs.m_info) &&
-         !rhs.m_info.owner_before(lhs.m_info));
+        (!lhs.m_scheduler.owner_before(rhs.m_scheduler) &&
+         !rhs.m_scheduler.owner_before(lhs.m_scheduler) &&
+         lhs.m_slot == rhs.m_slot &&
+         lhs.m_generation == rhs.m_generation);
   }
 
   friend bool
@@ -99,10 +110,17 @@ private:
   }
 
 private:
-  EventId(Scheduler& sched, weak_ptr<EventInfo> info);
+  EventId(const shared_ptr<Scheduler*>& sched, uint32_t slot, uint64_t generation) noexcept
+    : m_scheduler(sched)
+    , m_slot(slot)
+    , m_generation(generation)
+  {
+  }
 
 private:
-  weak_ptr<EventInfo> m_info;
+  weak_ptr<Scheduler*> m_scheduler; ///< expires when the scheduler is destructed
+  uint32_t m_slot = 0;
+  uint64_t m_generation = 0;
 
   friend class Scheduler;
   friend std::ostream& operator<<(std::ostream& os, const EventId& eventId);
@@ -123,9 +141,8 @@ operator<<(std::ostream& os, const EventId& eventId);
  *  } // eid goes out of scope, canceling the event
  *  \endcode
  *
- *  \note Canceling an expired (executed) or canceled event has no effect.
- *  \warning Canceling an event after the scheduler has been destructed may trigger undefined
- *           behavior.
+ *  \note Canceling an expired (executed) or canceled event has no effect, and neither does
+ *        canceling an event after the scheduler has been destructed.
  */
 using ScopedEventId = detail::ScopedCancelHandle<EventId>;
 
@@ -134,8 +151,38 @@ using ScopedEventId = detail::ScopedCancelHandle<EventId>;
 class Scheduler : noncopyable
 {
 public:
+  /** \brief Data structure that keeps scheduled events
+   */
+  enum class Backend {
+    /** \brief Events are kept in a binary heap.
+     *
+     *  Each event executes as soon as its delay has elapsed, and events execute in order of
+     *  expiration. Scheduling and canceling an event are O(log n).
+     */
+    PRIORITY_QUEUE,
+    /** \brief Events are kept in a hierarchical timing wheel with a resolution of 1 millisecond.
+     *
+     *  An event may execute up to one millisecond after its delay has elapsed, and events that
+     *  expire within the same millisecond execute in an unspecified order. Scheduling and
+     *  canceling an event are O(1), which suits many short-lived timeouts.
+     */
+    TIMING_WHEEL,
+  };
+
+  /** \brief Counters of the internal timer
+   *
+   *  The counters only increase; sample them periodically to obtain rates.
+   */
+  struct TimerCounters
+  {
+    uint64_t nArms = 0;     ///< number of times the timer was set to a new expiry
+    uint64_t nCancels = 0;  ///< number of times the timer was canceled
+    uint64_t nWakeups = 0;  ///< number of times the timer expired
+    uint64_t nEmptyWakeups = 0; ///< number of expirations that did not execute any event
+  };
+
   explicit
-  Scheduler(boost::asio::io_service& ioService);
+  Scheduler(boost::asio::io_service& ioService, Backend backend = Backend::PRIORITY_QUEUE);
 
   ~Scheduler();
 
@@ -150,15 +197,80 @@ public:
   void
   cancelAllEvents();
 
+  /** \brief Allow events to execute up to \p slack after their delay has elapsed
+   *
+   *  The internal timer is set to expire \p slack after the earliest event, and it is not reset
+   *  as long as its expiry is within \p slack after the earliest event. All events that have
+   *  expired when the timer expires are executed together, so that events close in time share
+   *  one timer expiration. The default is zero.
+   */
+  void
+  setTimerSlack(time::nanoseconds slack);
+
+  const TimerCounters&
+  getTimerCounters() const noexcept
+  {
+    return m_timerCounters;
+  }
+
 private:
+  /** \brief Take an unused event record from the pool
+   *  \return slot of the record
+   */
+  uint32_t
+  allocateEvent();
+
+  /** \brief Return an event record to the pool, invalidating all EventIds that refer to it
+   *  \return the callback of the event
+   *
+   *  The caller should destroy the returned callback only after the scheduler is consistent again,
+   *  in case the destructor of the callback cancels another event.
+   */
+  EventCallback
+  releaseEvent(uint32_t slot);
+
+  EventInfo&
+  getEvent(uint32_t slot) const;
+
+  bool
+  isPending(uint32_t slot, uint64_t generation) const noexcept;
+
+  void
+  cancelImpl(uint32_t slot, uint64_t generation);
+
+  void
+  pushHeap(uint32_t slot);
+
+  void
+  eraseHeap(size_t pos);
+
   void
-  cancelImpl(const shared_ptr<EventInfo>& info);
+  siftUp(size_t pos);
+
+  void
+  siftDown(size_t pos);
+
+  /** \brief Whether the event in \p a expires before the event in \p b
+   */
+  bool
+  isEarlier(uint32_t a, uint32_t b) const;
 
   /** \brief Schedule the next event on the internal timer
    */
   void
   scheduleNext();
 
+  /** \brief Set the internal timer for an event that expires at \p expiry
+   *
+   *  The timer is left unchanged if it is already set to expire no later than the timer slack
+   *  after \p expiry. If it expires earlier than the event, scheduleNext() is invoked again then.
+   */
+  void
+  armTimer(time::steady_clock::TimePoint expiry);
+
+  void
+  cancelTimer();
+
   /** \brief Execute expired events
    *
    *  If an event callback throws, the exception is propagated to the thread running the io_service.
@@ -168,19 +280,27 @@ private:
   executeEvent(const boost::system::error_code& code);
 
 private:
-  class EventQueueCompare
-  {
-  public:
-    bool
-    operator()(const shared_ptr<EventInfo>& a, const shared_ptr<EventInfo>& b) const noexcept;
-  };
+  std::vector<unique_ptr<EventInfo[]>> m_events; ///< pool of event records, in fixed-size chunks
+  uint32_t m_freeEvents; ///< first unused event record
+  uint64_t m_nextSequence = 0; ///< orders events that expire at the same time
 
-  using EventQueue = std::multiset<shared_ptr<EventInfo>, EventQueueCompare>;
-  EventQueue m_queue;
+  std::vector<uint32_t> m_heap; ///< binary heap of pending events with Backend::PRIORITY_QUEUE
+
+  using EventWheel = util::detail::TimingWheel<uint32_t>;
+  unique_ptr<EventWheel> m_wheel; ///< pending events with Backend::TIMING_WHEEL
+  time::steady_clock::TimePoint m_wheelEpoch; ///< time point of the wheel's tick 0
 
   unique_ptr<util::detail::SteadyTimer> m_timer;
+  time::steady_clock::TimePoint m_timerExpiry; ///< expiry of the timer, if it is waiting
+  bool m_isTimerArmed = false;
+  time::nanoseconds m_timerSlack = 0_ns;
+  TimerCounters m_timerCounters;
   bool m_isEventExecuting = false;
 
+  /** \brief Shared with EventIds, so that they can tell whether the scheduler still exists
+   */
+  shared_ptr<Scheduler*> m_self;
+
   friend EventId;
   friend EventInfo;
 };
@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_TESTS_BENCHMARKS_COUNT_ALLOCATIONS_HPP
+#define NDN_CXX_TESTS_BENCHMARKS_COUNT_ALLOCATIONS_HPP
+
+// This header replaces the global operator new and operator delete, so it must be included
+// by only one translation unit of a benchmark program.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace ndn {
+namespace tests {
+
+struct AllocStats
+{
+  size_t nAllocs;
+  size_t nBytes;
+};
+
+namespace detail {
+
+// heap allocations made by this program since it started
+static AllocStats g_allocTotals{0, 0};
+
+} // namespace detail
+
+/** \brief Count the heap allocations made while executing \p f
+ */
+template<typename F>
+AllocStats
+countAllocations(const F& f)
+{
+  AllocStats before = detail::g_allocTotals;
+  f();
+  return {detail::g_allocTotals.nAllocs - before.nAllocs,
+          detail::g_allocTotals.nBytes - before.nBytes};
+}
+
+} // namespace tests
+} // namespace ndn
+
+void*
+operator new(std::size_t size)
+{
+  ++ndn::tests::detail::g_allocTotals.nAllocs;
+  ndn::tests::detail::g_allocTotals.nBytes += size;
+  void* p = std::malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+#endif // NDN_CXX_TESTS_BENCHMARKS_COUNT_ALLOCATIONS_HPP
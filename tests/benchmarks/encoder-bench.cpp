@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Encoder Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/meta-info.hpp"
+#include "ndn-cxx/mgmt/nfd/control-parameters.hpp"
+#include "ndn-cxx/name.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "tests/benchmarks/count-allocations.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+#include <iostream>
+
+namespace ndn {
+namespace encoding {
+namespace tests {
+
+using namespace ndn::tests;
+
+struct NameTest
+{
+  static const char*
+  getName()
+  {
+    return "Name";
+  }
+
+  static Name
+  makeObject()
+  {
+    return Name("/benchmark/encoder/a/b/c/d/e/f/g/h");
+  }
+};
+
+struct MetaInfoTest
+{
+  static const char*
+  getName()
+  {
+    return "MetaInfo";
+  }
+
+  static MetaInfo
+  makeObject()
+  {
+    MetaInfo metaInfo;
+    metaInfo.setFreshnessPeriod(1_s);
+    metaInfo.setFinalBlock(name::Component::fromSegment(10));
+    return metaInfo;
+  }
+};
+
+struct ControlParametersTest
+{
+  static const char*
+  getName()
+  {
+    return "ControlParameters";
+  }
+
+  static nfd::ControlParameters
+  makeObject()
+  {
+    return nfd::ControlParameters()
+      .setName("/benchmark/encoder")
+      .setFaceId(262)
+      .setCost(10)
+      .setFlags(0);
+  }
+};
+
+using EncodeTests = boost::mpl::vector<NameTest, MetaInfoTest, ControlParametersTest>;
+
+// Compares encoding into a default-constructed EncodingBuffer, which reserves MAX_NDN_PACKET_SIZE
+// bytes, against the estimator-first encoding used by the library's wireEncode() methods.
+// For accurate timings, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Encode, Test, EncodeTests)
+{
+  const int N_ITERATIONS = 1000000;
+  const auto obj = Test::makeObject();
+
+  size_t totalSize = 0;
+  AllocStats defaultAllocs{};
+  auto d1 = timedExecute([&] {
+    defaultAllocs = countAllocations([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        EncodingBuffer encoder;
+        obj.wireEncode(encoder);
+        totalSize += encoder.block().size();
+      }
+    });
+  });
+
+  AllocStats estimatedAllocs{};
+  auto d2 = timedExecute([&] {
+    estimatedAllocs = countAllocations([&] {
+      for (int i = 0; i < N_ITERATIONS; ++i) {
+        EncodingEstimator estimator;
+        size_t estimatedSize = obj.wireEncode(estimator);
+        EncodingBuffer encoder(estimatedSize, 0);
+        obj.wireEncode(encoder);
+        totalSize -= encoder.block().size();
+      }
+    });
+  });
+
+  BOOST_CHECK_EQUAL(totalSize, 0);
+  std::cout << Test::getName() << " default-reserve: "
+            << static_cast<double>(defaultAllocs.nAllocs) / N_ITERATIONS << " allocs/encode, "
+            << defaultAllocs.nBytes / N_ITERATIONS << " bytes/encode, " << d1 << std::endl;
+  std::cout << Test::getName() << " estimator-first: "
+            << static_cast<double>(estimatedAllocs.nAllocs) / N_ITERATIONS << " allocs/encode, "
+            << estimatedAllocs.nBytes / N_ITERATIONS << " bytes/encode, " << d2 << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(SignData)
+{
+  const int N_ITERATIONS = 10000;
+
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  keyChain.createIdentity("/benchmark/encoder");
+
+  std::vector<Data> packets(N_ITERATIONS);
+  for (int i = 0; i < N_ITERATIONS; ++i) {
+    packets[i].setName(Name("/benchmark/encoder/data").appendSegment(i));
+    packets[i].setFreshnessPeriod(1_s);
+  }
+
+  AllocStats allocs{};
+  auto d = timedExecute([&] {
+    allocs = countAllocations([&] {
+      for (auto& data : packets) {
+        keyChain.sign(data, signingWithSha256());
+      }
+    });
+  });
+
+  std::cout << "sign Data with SHA-256 digest: "
+            << static_cast<double>(allocs.nAllocs) / N_ITERATIONS << " allocs/sign, "
+            << allocs.nBytes / N_ITERATIONS << " bytes/sign, " << d << std::endl;
+}
+
+} // namespace tests
+} // namespace encoding
+} // namespace ndn
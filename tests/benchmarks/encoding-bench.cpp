@@ -23,7 +23,9 @@
 #include "tests/boost-test.hpp"
 
 #include "ndn-cxx/encoding/tlv.hpp"
+#include "ndn-cxx/lp/packet.hpp"
 #include "tests/benchmarks/timed-execute.hpp"
+#include "tests/test-common.hpp"
 
 #include <boost/mpl/vector.hpp>
 #include <boost/mpl/vector_c.hpp>
@@ -128,6 +130,106 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ReadVarNumber, Test, ReadVarNumberTests)
             << " " << d << std::endl;
 }
 
+// Concatenated wire encoding of a mix of packets, as received on a stream face:
+// 50% Interests, 30% Data with 1000-octet Content, 10% Data with 100-octet Content,
+// and 10% NDNLPv2 packets carrying an Interest.
+static Buffer
+makePacketMix(size_t nPackets)
+{
+  const Buffer content(1000);
+  const Buffer pitToken{0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7};
+  Buffer mix;
+  for (size_t i = 0; i < nPackets; ++i) {
+    ndn::Name name = ndn::Name("/benchmark/encoding/mix/packet").appendSegment(i);
+    Block wire;
+    switch (i % 10) {
+      case 0: case 1: case 2: {
+        auto data = makeData(name);
+        data->setContent(content.data(), content.size());
+        wire = signData(data)->wireEncode();
+        break;
+      }
+      case 3: {
+        auto data = makeData(name);
+        data->setContent(content.data(), 100);
+        wire = signData(data)->wireEncode();
+        break;
+      }
+      case 4: {
+        lp::Packet packet(makeInterest(name)->wireEncode());
+        packet.add<lp::PitTokenField>(std::make_pair(pitToken.begin(), pitToken.end()));
+        packet.add<lp::CongestionMarkField>(1);
+        wire = packet.wireEncode();
+        break;
+      }
+      default: {
+        wire = makeInterest(name, false, 4_s)->wireEncode();
+        break;
+      }
+    }
+    mix.insert(mix.end(), wire.begin(), wire.end());
+  }
+  return mix;
+}
+
+// Throughput of locating the top-level elements of a stream, and of parsing their sub-elements.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(IndexPacketMix)
+{
+  const int N_ITERATIONS = 1000;
+  const Buffer mix = makePacketMix(1000);
+  const double nBytes = static_cast<double>(mix.size()) * N_ITERATIONS;
+  auto gbps = [nBytes] (time::nanoseconds d) { return nBytes / d.count(); };
+
+  std::vector<ElementIndexEntry> index;
+  size_t nElements1 = 0;
+  auto d1 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      const uint8_t* pos = mix.data();
+      const uint8_t* end = pos + mix.size();
+      while (pos != end) {
+        readType(pos, end);
+        pos += readVarNumber(pos, end);
+        ++nElements1;
+      }
+    }
+  });
+
+  size_t nElements2 = 0;
+  auto d2 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      index.clear();
+      indexElements(mix.data(), mix.size(), std::back_inserter(index));
+      nElements2 += index.size();
+    }
+  });
+
+  // Block::parse of each packet, i.e. indexing one level of sub-elements
+  auto buffer = make_shared<const Buffer>(mix);
+  std::vector<Block> packets;
+  for (const auto& entry : index) {
+    packets.emplace_back(buffer, entry.type, buffer->begin() + entry.begin, buffer->begin() + entry.end,
+                         buffer->begin() + entry.valueBegin, buffer->begin() + entry.end);
+  }
+  size_t nElements3 = 0;
+  auto d3 = timedExecute([&] {
+    for (int i = 0; i < N_ITERATIONS; ++i) {
+      for (const auto& packet : packets) {
+        Block copy(packet); // not parsed yet
+        copy.parse();
+        nElements3 += copy.elements_size();
+      }
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nElements1, nElements2);
+  BOOST_CHECK_GT(nElements3, nElements2);
+  std::cout << "packet mix of " << mix.size() << " octets:\n"
+            << "  readType+readVarNumber loop: " << gbps(d1) << " GB/s\n"
+            << "  indexElements: " << gbps(d2) << " GB/s\n"
+            << "  Block::parse of each packet: " << gbps(d3) << " GB/s" << std::endl;
+}
+
 } // namespace tests
 } // namespace tlv
 } // namespace ndn
@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Face Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/util/dummy-client-face.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/test-common.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <iostream>
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+class FaceBenchFixture
+{
+protected:
+  FaceBenchFixture()
+    : keyChain("pib-memory:", "tpm-memory:")
+    , face(io, keyChain, {false, false})
+  {
+  }
+
+protected:
+  boost::asio::io_service io;
+  KeyChain keyChain;
+  util::DummyClientFace face;
+};
+
+// Time to satisfy all outstanding Interests with incoming Data, one Data per Interest.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_FIXTURE_TEST_CASE(SatisfyPendingInterests, FaceBenchFixture)
+{
+  for (size_t nInterests : {1000, 10000, 100000}) {
+    std::vector<shared_ptr<Data>> packets;
+    packets.reserve(nInterests);
+    size_t nSatisfied = 0;
+    for (size_t i = 0; i < nInterests; ++i) {
+      Name name = Name("/benchmark/face/fetcher").appendSegment(i);
+      // every other Interest has CanBePrefix, so that both exact and prefix matching are exercised
+      face.expressInterest(*makeInterest(name, i % 2 == 1, 1_h),
+                           [&] (const Interest&, const Data&) { ++nSatisfied; },
+                           nullptr, nullptr);
+      packets.push_back(makeData(name));
+    }
+    io.poll();
+    BOOST_REQUIRE_EQUAL(face.getNPendingInterests(), nInterests);
+
+    auto d = timedExecute([&] {
+      for (const auto& data : packets) {
+        face.receive(*data);
+      }
+    });
+
+    BOOST_CHECK_EQUAL(nSatisfied, nInterests);
+    BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+    std::cout << "satisfy " << nInterests << " pending Interests: " << d << ", "
+              << d.count() / nInterests << " ns/Data" << std::endl;
+  }
+}
+
+// Time to dispatch incoming Interests to InterestFilters, as a function of the number of filters.
+// Each Interest matches exactly one filter.
+BOOST_FIXTURE_TEST_CASE(DispatchInterest, FaceBenchFixture)
+{
+  const size_t nInterests = 100000;
+
+  for (size_t nFilters : {10, 100, 1000}) {
+    std::vector<ScopedInterestFilterHandle> handles;
+    for (size_t i = 0; i < nFilters; ++i) {
+      handles.push_back(face.setInterestFilter(Name("/benchmark/face/producer").appendNumber(i),
+                                               nullptr));
+    }
+    // one regex filter, which should only be evaluated for Interests under its prefix
+    handles.push_back(face.setInterestFilter(InterestFilter("/benchmark/regex", "<>*"), nullptr));
+    io.poll();
+
+    std::vector<shared_ptr<Interest>> interests;
+    interests.reserve(nInterests);
+    for (size_t i = 0; i < nInterests; ++i) {
+      Name name = Name("/benchmark/face/producer").appendNumber(i % nFilters).appendSegment(i);
+      interests.push_back(makeInterest(name, false, 1_h));
+    }
+
+    auto d = timedExecute([&] {
+      for (const auto& interest : interests) {
+        face.receive(*interest);
+      }
+    });
+
+    std::cout << "dispatch " << nInterests << " Interests to " << nFilters << " filters: " << d
+              << ", " << d.count() / nInterests << " ns/Interest" << std::endl;
+
+    handles.clear();
+    face.removeAllPendingInterests();
+    io.poll();
+  }
+}
+
+// Throughput of Interests expressed by producer threads while the io_service runs on the main
+// thread, either by posting expressInterest to the io_service or through submitInterest.
+BOOST_FIXTURE_TEST_CASE(SubmitInterests, FaceBenchFixture)
+{
+  const size_t nInterests = 160000;
+
+  for (bool useSubmit : {false, true}) {
+    for (size_t nThreads : {1, 4, 16}) {
+      std::vector<std::vector<shared_ptr<Interest>>> interests(nThreads);
+      for (size_t t = 0; t < nThreads; ++t) {
+        for (size_t i = 0; i < nInterests / nThreads; ++i) {
+          Name name = Name("/benchmark/face/submit").appendNumber(t).appendSegment(i);
+          interests[t].push_back(makeInterest(name, false, 1_h));
+        }
+      }
+
+      auto d = timedExecute([&] {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < nThreads; ++t) {
+          threads.emplace_back([&, t] {
+            for (const auto& interest : interests[t]) {
+              if (useSubmit) {
+                face.submitInterest(*interest, nullptr, nullptr, nullptr);
+              }
+              else {
+                io.post([this, interest] { face.expressInterest(*interest, nullptr, nullptr, nullptr); });
+              }
+            }
+          });
+        }
+
+        while (face.getNPendingInterests() < nInterests) {
+          io.poll();
+          io.reset();
+        }
+        for (auto& thread : threads) {
+          thread.join();
+        }
+      });
+
+      std::cout << (useSubmit ? "submitInterest" : "post+expressInterest") << " from " << nThreads
+                << " threads: " << d << ", "
+                << static_cast<uint64_t>(nInterests / (d.count() / 1e9)) << " Interests/s" << std::endl;
+
+      face.removeAllPendingInterests();
+      io.poll();
+      io.reset();
+    }
+  }
+}
+
+} // namespace tests
+} // namespace ndn
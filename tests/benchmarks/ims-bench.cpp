@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx InMemoryStorage Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/ims/in-memory-storage-fifo.hpp"
+#include "ndn-cxx/ims/in-memory-storage-file.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lfu.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lru.hpp"
+#include "ndn-cxx/ims/in-memory-storage-tinylfu.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/test-common.hpp"
+
+#include <boost/core/demangle.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <iostream>
+#include <random>
+
+namespace ndn {
+namespace tests {
+
+// Time to restart a producer that caches 1M packets: signing and inserting every packet again,
+// versus recovering them from the log of InMemoryStorageFile.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(Recover)
+{
+  const size_t N_PACKETS = 1000000;
+  const auto logPath = boost::filesystem::temp_directory_path() /
+                       boost::filesystem::unique_path("ndn-cxx-ims-bench-%%%%-%%%%.log");
+
+  {
+    KeyChain keyChain("pib-memory:", "tpm-memory:");
+    InMemoryStoragePersistent ims;
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < N_PACKETS; ++i) {
+        auto data = make_shared<Data>(Name("/benchmark/ims").appendSegment(i));
+        data->setFreshnessPeriod(1_h);
+        keyChain.sign(*data, signingWithSha256());
+        ims.insert(*data);
+      }
+    });
+    BOOST_REQUIRE_EQUAL(ims.size(), N_PACKETS);
+    std::cout << "sign and insert " << N_PACKETS << " packets: " << d << std::endl;
+
+    InMemoryStorageFile log(logPath.string());
+    for (const Data& data : ims) {
+      log.insert(data);
+    }
+    BOOST_REQUIRE_EQUAL(log.size(), N_PACKETS);
+  }
+  std::cout << "log size: " << boost::filesystem::file_size(logPath) << " bytes" << std::endl;
+
+  unique_ptr<InMemoryStorageFile> ims;
+  auto d = timedExecute([&] {
+    ims = make_unique<InMemoryStorageFile>(logPath.string());
+  });
+  BOOST_CHECK_EQUAL(ims->size(), N_PACKETS);
+  std::cout << "recover " << N_PACKETS << " packets from log: " << d << ", "
+            << d.count() / N_PACKETS << " ns/packet" << std::endl;
+
+  ims.reset();
+  boost::filesystem::remove(logPath);
+}
+
+using Policies = boost::mpl::vector<InMemoryStorageFifo,
+                                   InMemoryStorageLfu,
+                                   InMemoryStorageLru,
+                                   InMemoryStorageTinyLfu>;
+
+const size_t N_NAMES = 100000;
+const size_t N_REQUESTS = 1000000;
+const size_t CACHE_LIMIT = 1000;
+
+/** \brief Generates a request trace in which name i is requested with probability ~ 1/(i+1).
+ *
+ *  When \p scanRatio is positive, that fraction of requests is replaced by a sequential scan
+ *  over names that are never requested again.
+ */
+static std::vector<size_t>
+makeTrace(double scanRatio)
+{
+  std::vector<double> weights(N_NAMES);
+  for (size_t i = 0; i < N_NAMES; ++i) {
+    weights[i] = 1.0 / (i + 1);
+  }
+  std::mt19937 rng(6100);
+  std::discrete_distribution<size_t> zipf(weights.begin(), weights.end());
+  std::bernoulli_distribution isScan(scanRatio);
+
+  std::vector<size_t> trace;
+  trace.reserve(N_REQUESTS);
+  size_t nextScan = N_NAMES;
+  for (size_t i = 0; i < N_REQUESTS; ++i) {
+    trace.push_back(isScan(rng) ? nextScan++ : zipf(rng));
+  }
+  return trace;
+}
+
+// Hit ratio and throughput of each replacement policy on a request trace, where a miss
+// inserts the requested packet. For accurate timings, compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE_TEMPLATE(ReplacementPolicy, Policy, Policies)
+{
+  for (double scanRatio : {0.0, 0.5}) {
+    auto trace = makeTrace(scanRatio);
+    std::vector<shared_ptr<Data>> packets(N_NAMES + N_REQUESTS);
+    std::vector<shared_ptr<Interest>> interests(packets.size());
+    for (size_t i : trace) {
+      if (packets[i] == nullptr) {
+        Name name = Name("/benchmark/ims/policy").appendNumber(i);
+        packets[i] = makeData(name);
+        interests[i] = makeInterest(name);
+      }
+    }
+
+    Policy ims(CACHE_LIMIT);
+    size_t nHits = 0;
+    auto d = timedExecute([&] {
+      for (size_t i : trace) {
+        if (ims.find(*interests[i]) != nullptr) {
+          ++nHits;
+        }
+        else {
+          ims.insert(*packets[i]);
+        }
+      }
+    });
+
+    BOOST_CHECK_LE(ims.size(), CACHE_LIMIT);
+    std::cout << boost::core::demangle(typeid(Policy).name()) << (scanRatio > 0 ? " zipf+scan: " : " zipf: ")
+              << "hit ratio " << static_cast<double>(nHits) / N_REQUESTS << ", " << d << ", "
+              << d.count() / N_REQUESTS << " ns/request" << std::endl;
+  }
+}
+
+} // namespace tests
+} // namespace ndn
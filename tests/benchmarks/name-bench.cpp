@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Name Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/name.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <boost/mpl/vector_c.hpp>
+
+#include <iostream>
+#include <unordered_set>
+
+namespace ndn {
+namespace tests {
+
+static Name
+makeName(size_t nComponents, size_t id)
+{
+  Name name("/benchmark/name");
+  while (name.size() < nComponents - 1) {
+    name.append("component-" + to_string(name.size()));
+  }
+  return name.appendNumber(id);
+}
+
+// Hash computed the way std::hash<Name> used to: over the whole wire encoding.
+static size_t
+hashWire(const Name& name)
+{
+  const Block& wire = name.wireEncode();
+  return boost::hash_range(wire.wire(), wire.wire() + wire.size());
+}
+
+using NameSizes = boost::mpl::vector_c<size_t, 10, 20>;
+
+// For accurate timings, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Hash, NComponents, NameSizes)
+{
+  const size_t N_NAMES = 1000;
+  const int N_ITERATIONS = 1000;
+
+  std::vector<Name> names;
+  for (size_t i = 0; i < N_NAMES; ++i) {
+    names.push_back(makeName(NComponents::value, i));
+    names.back().wireEncode();
+  }
+
+  size_t sum = 0;
+  auto d1 = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (const auto& name : names) {
+        sum += hashWire(name);
+      }
+    }
+  });
+
+  auto d2 = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (const auto& name : names) {
+        Name copy = name; // copying does not preserve the cached hash of a modified name
+        copy.append(name::Component());
+        copy.erase(-1);
+        sum += copy.getHash();
+      }
+    }
+  });
+
+  auto d3 = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (const auto& name : names) {
+        sum += name.getHash();
+      }
+    }
+  });
+
+  // hash values of all prefixes, as in a longest prefix match on a hash table
+  auto d4 = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (const auto& name : names) {
+        for (size_t i = 0; i <= name.size(); ++i) {
+          sum += name.getPrefix(i).getHash();
+        }
+      }
+    }
+  });
+
+  auto d5 = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (const auto& name : names) {
+        for (size_t i = 0; i <= name.size(); ++i) {
+          sum += name.getPrefixHash(i);
+        }
+      }
+    }
+  });
+
+  BOOST_CHECK_NE(sum, 0);
+  const size_t n = N_NAMES * N_ITERATIONS;
+  std::cout << NComponents::value << "-component Name hash:\n"
+            << "  wire hash: " << d1.count() / n << " ns\n"
+            << "  uncached hash (includes copy): " << d2.count() / n << " ns\n"
+            << "  cached hash: " << d3.count() / n << " ns\n"
+            << "  all prefixes with getPrefix(): " << d4.count() / n << " ns\n"
+            << "  all prefixes with getPrefixHash(): " << d5.count() / n << " ns" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(Compare, NComponents, NameSizes)
+{
+  const size_t N_NAMES = 1000;
+  const int N_ITERATIONS = 1000;
+
+  std::vector<Name> names1, names2;
+  for (size_t i = 0; i < N_NAMES; ++i) {
+    // names differ only in the last component
+    names1.push_back(makeName(NComponents::value, i));
+    names2.push_back(makeName(NComponents::value, i + 1));
+    names1.back().wireEncode();
+    names2.back().wireEncode();
+  }
+
+  int nLess = 0;
+  auto d1 = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (size_t i = 0; i < N_NAMES; ++i) {
+        nLess += names1[i].compare(names2[i]) < 0;
+      }
+    }
+  });
+
+  int nEqual = 0;
+  auto d2 = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (size_t i = 0; i < N_NAMES; ++i) {
+        nEqual += names1[i] == names1[i];
+        nEqual += names1[i] == names2[i];
+      }
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nLess, N_NAMES * N_ITERATIONS);
+  BOOST_CHECK_EQUAL(nEqual, N_NAMES * N_ITERATIONS);
+  const size_t n = N_NAMES * N_ITERATIONS;
+  std::cout << NComponents::value << "-component Name compare: " << d1.count() / n << " ns, "
+            << "equals: " << d2.count() / n / 2 << " ns" << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UnorderedSetLookup, NComponents, NameSizes)
+{
+  const size_t N_NAMES = 10000;
+  const int N_ITERATIONS = 100;
+
+  std::unordered_set<Name> table;
+  std::vector<Name> keys;
+  for (size_t i = 0; i < N_NAMES; ++i) {
+    table.insert(makeName(NComponents::value, i));
+    // lookup keys are distinct objects, decoded from the wire as received names would be
+    keys.emplace_back(table.find(makeName(NComponents::value, i))->wireEncode());
+  }
+
+  size_t nFound = 0;
+  auto d = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (const auto& key : keys) {
+        nFound += table.count(key);
+      }
+    }
+  });
+
+  BOOST_CHECK_EQUAL(nFound, N_NAMES * N_ITERATIONS);
+  std::cout << NComponents::value << "-component Name unordered_set lookup: "
+            << d.count() / (N_NAMES * N_ITERATIONS) << " ns" << std::endl;
+}
+
+} // namespace tests
+} // namespace ndn
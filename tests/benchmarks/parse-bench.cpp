@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Parse Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/lp/packet.hpp"
+#include "tests/benchmarks/count-allocations.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/test-common.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+#include <iostream>
+
+namespace ndn {
+namespace tests {
+
+struct InterestTest
+{
+  static const char*
+  getName()
+  {
+    return "Interest";
+  }
+
+  static Block
+  makeWire()
+  {
+    const uint8_t PARAMETERS[] = {0xc0, 0xc1, 0xc2, 0xc3};
+    auto interest = makeInterest("/benchmark/parse/interest/a/b/c", true, 4_s);
+    interest->setMustBeFresh(true);
+    interest->setHopLimit(64);
+    interest->setApplicationParameters(PARAMETERS, sizeof(PARAMETERS));
+    return interest->wireEncode();
+  }
+
+  static void
+  decode(const Block& wire)
+  {
+    Interest interest(wire);
+  }
+};
+
+struct DataTest
+{
+  static const char*
+  getName()
+  {
+    return "Data";
+  }
+
+  static Block
+  makeWire()
+  {
+    const uint8_t CONTENT[] = {0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7};
+    auto data = makeData("/benchmark/parse/data/a/b/c");
+    data->setFreshnessPeriod(1_s);
+    data->setContent(CONTENT, sizeof(CONTENT));
+    signData(data);
+    return data->wireEncode();
+  }
+
+  static void
+  decode(const Block& wire)
+  {
+    Data data(wire);
+  }
+};
+
+struct LpPacketTest
+{
+  static const char*
+  getName()
+  {
+    return "lp::Packet";
+  }
+
+  static Block
+  makeWire()
+  {
+    const Buffer pitToken{0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7};
+    lp::Packet packet(makeInterest("/benchmark/parse/lp")->wireEncode());
+    packet.add<lp::SequenceField>(1000);
+    packet.add<lp::PitTokenField>(std::make_pair(pitToken.begin(), pitToken.end()));
+    packet.add<lp::IncomingFaceIdField>(262);
+    packet.add<lp::CongestionMarkField>(1);
+    return packet.wireEncode();
+  }
+
+  static void
+  decode(const Block& wire)
+  {
+    lp::Packet packet(wire);
+    packet.get<lp::FragmentField>(); // locate the network-layer packet, as Face does
+  }
+};
+
+using ParseTests = boost::mpl::vector<InterestTest, DataTest, LpPacketTest>;
+
+// Time and heap allocations to decode a packet from a freshly received wire encoding.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE_TEMPLATE(Parse, Test, ParseTests)
+{
+  const int N_ITERATIONS = 1000000;
+
+  const Block original = Test::makeWire();
+  std::vector<Block> wires;
+  wires.reserve(N_ITERATIONS);
+  for (int i = 0; i < N_ITERATIONS; ++i) {
+    // each Block refers to the same buffer but has not been parsed yet
+    wires.emplace_back(original.getBuffer(), original.begin(), original.end());
+  }
+
+  AllocStats allocs{};
+  auto d = timedExecute([&] {
+    allocs = countAllocations([&] {
+      for (const auto& wire : wires) {
+        Test::decode(wire);
+      }
+    });
+  });
+
+  std::cout << Test::getName() << " (" << original.size() << " octets): "
+            << d.count() / N_ITERATIONS << " ns/decode, "
+            << static_cast<double>(allocs.nAllocs) / N_ITERATIONS << " allocs/decode" << std::endl;
+}
+
+} // namespace tests
+} // namespace ndn
@@ -34,56 +34,75 @@ namespace tests {
 
 using namespace ndn::tests;
 
-BOOST_AUTO_TEST_CASE(ScheduleCancel)
-{
-  boost::asio::io_service io;
-  Scheduler sched(io);
+const Scheduler::Backend BACKENDS[] = {Scheduler::Backend::PRIORITY_QUEUE,
+                                        Scheduler::Backend::TIMING_WHEEL};
 
-  const size_t nEvents = 1000000;
-  std::vector<EventId> eventIds(nEvents);
-
-  auto d1 = timedExecute([&] {
-    for (size_t i = 0; i < nEvents; ++i) {
-      eventIds[i] = sched.schedule(1_s, []{});
-    }
-  });
+static const char*
+getBackendName(Scheduler::Backend backend)
+{
+  return backend == Scheduler::Backend::TIMING_WHEEL ? "timing-wheel" : "priority-queue";
+}
 
-  auto d2 = timedExecute([&] {
-    for (size_t i = 0; i < nEvents; ++i) {
-      eventIds[i].cancel();
+BOOST_AUTO_TEST_CASE(ScheduleCancel)
+{
+  for (auto backend : BACKENDS) {
+    for (size_t nEvents : {10000, 100000, 1000000}) {
+      boost::asio::io_service io;
+      Scheduler sched(io, backend);
+      std::vector<EventId> eventIds(nEvents);
+
+      auto d1 = timedExecute([&] {
+        for (size_t i = 0; i < nEvents; ++i) {
+          // spread the events over 4 seconds, as Interest timeouts would be
+          eventIds[i] = sched.schedule(1_s + time::microseconds(i % 4000000), []{});
+        }
+      });
+
+      auto d2 = timedExecute([&] {
+        for (size_t i = 0; i < nEvents; ++i) {
+          eventIds[i].cancel();
+        }
+      });
+
+      std::cout << getBackendName(backend) << " schedule " << nEvents << " events: " << d1
+                << ", " << d1.count() / nEvents << " ns/event" << std::endl;
+      std::cout << getBackendName(backend) << " cancel " << nEvents << " events: " << d2
+                << ", " << d2.count() / nEvents << " ns/event" << std::endl;
+      std::cout << getBackendName(backend) << " timer arms: " << sched.getTimerCounters().nArms
+                << ", cancels: " << sched.getTimerCounters().nCancels << std::endl;
     }
-  });
-
-  std::cout << "schedule " << nEvents << " events: " << d1 << std::endl;
-  std::cout << "cancel " << nEvents << " events: " << d2 << std::endl;
+  }
 }
 
 BOOST_AUTO_TEST_CASE(Execute)
 {
-  boost::asio::io_service io;
-  Scheduler sched(io);
-
-  const size_t nEvents = 1000000;
-  size_t nExpired = 0;
-
-  // Events should expire at t1, but execution finishes at t2. The difference is the overhead.
-  time::steady_clock::TimePoint t1 = time::steady_clock::now() + 5_s;
-  time::steady_clock::TimePoint t2;
-  // +1ms ensures this extra event is executed last. In case the overhead is less than 1ms,
-  // it will be reported as 1ms.
-  sched.schedule(t1 - time::steady_clock::now() + 1_ms, [&] {
-    t2 = time::steady_clock::now();
-    BOOST_REQUIRE_EQUAL(nExpired, nEvents);
-  });
-
-  for (size_t i = 0; i < nEvents; ++i) {
-    sched.schedule(t1 - time::steady_clock::now(), [&] { ++nExpired; });
+  for (auto backend : BACKENDS) {
+    for (size_t nEvents : {10000, 100000, 1000000}) {
+      boost::asio::io_service io;
+      Scheduler sched(io, backend);
+      size_t nExpired = 0;
+
+      // Events should expire at t1, but execution finishes at t2. The difference is the overhead.
+      time::steady_clock::TimePoint t1 = time::steady_clock::now() + 5_s;
+      time::steady_clock::TimePoint t2;
+      // +2ms ensures this extra event is executed last, including with the 1ms resolution of
+      // the timing wheel. In case the overhead is less than 2ms, it will be reported as 2ms.
+      sched.schedule(t1 - time::steady_clock::now() + 2_ms, [&] {
+        t2 = time::steady_clock::now();
+        BOOST_REQUIRE_EQUAL(nExpired, nEvents);
+      });
+
+      for (size_t i = 0; i < nEvents; ++i) {
+        sched.schedule(t1 - time::steady_clock::now(), [&] { ++nExpired; });
+      }
+
+      io.run();
+
+      BOOST_REQUIRE_EQUAL(nExpired, nEvents);
+      std::cout << getBackendName(backend) << " execute " << nEvents << " events: "
+                << (t2 - t1) << std::endl;
+    }
   }
-
-  io.run();
-
-  BOOST_REQUIRE_EQUAL(nExpired, nEvents);
-  std::cout << "execute " << nEvents << " events: " << (t2 - t1) << std::endl;
 }
 
 } // namespace tests
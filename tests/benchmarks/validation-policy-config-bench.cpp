@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Validation Policy Config Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/validation-state.hpp"
+#include "ndn-cxx/security/validator-config/rule-index.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <iostream>
+
+namespace ndn {
+namespace security {
+namespace validator_config {
+namespace tests {
+
+using namespace ndn::tests;
+
+// Rule lookups per second for a policy with many rules, when every rule is evaluated in turn
+// and when only the rules found through a RuleIndex are evaluated.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(MatchRule)
+{
+  const size_t nSites = 100;
+  const size_t nPackets = 10000;
+  const int N_ITERATIONS = 2;
+
+  // five rules per site, for a total of 500 rules
+  std::vector<unique_ptr<Rule>> rules;
+  auto addRule = [&rules] (unique_ptr<Filter> filter) {
+    rules.push_back(make_unique<Rule>("rule-" + to_string(rules.size()), tlv::Data));
+    rules.back()->addFilter(std::move(filter));
+  };
+  for (size_t i = 0; i < nSites; ++i) {
+    std::string site = "site" + to_string(i);
+    addRule(make_unique<RelationNameFilter>(Name("/benchmark").append(site).append("KEY"),
+                                            NameRelation::IS_STRICT_PREFIX_OF));
+    addRule(make_unique<RegexNameFilter>(Regex("^<benchmark><" + site + "><news><>*<v=.*>$")));
+    addRule(make_unique<RelationNameFilter>(Name("/benchmark").append(site).append("status"),
+                                            NameRelation::EQUAL));
+    addRule(make_unique<RegexNameFilter>(Regex("^<benchmark><" + site + "><mail>(<>*)<KEY>")));
+    addRule(make_unique<RelationNameFilter>(Name("/benchmark").append(site),
+                                            NameRelation::IS_PREFIX_OF));
+  }
+
+  RuleIndex index;
+  for (const auto& rule : rules) {
+    index.insert(*rule);
+  }
+
+  std::vector<Data> packets(nPackets);
+  std::vector<shared_ptr<ValidationState>> states(nPackets);
+  for (size_t i = 0; i < nPackets; ++i) {
+    Name name("/benchmark");
+    name.append("site" + to_string(i % nSites));
+    switch (i % 4) {
+      case 0:
+        name.append("news").append("article").appendVersion(i);
+        break;
+      case 1:
+        name.append("mail").append("alice").append("KEY").appendSegment(i);
+        break;
+      case 2:
+        name.append("status");
+        break;
+      default:
+        name.append("files").appendSegment(i);
+        break;
+    }
+    packets[i].setName(name);
+    states[i] = make_shared<DataValidationState>(packets[i], [] (const Data&) {},
+                                                 [] (const Data&, const ValidationError&) {});
+  }
+
+  std::vector<const Rule*> linearResults(nPackets);
+  auto d1 = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (size_t i = 0; i < nPackets; ++i) {
+        linearResults[i] = nullptr;
+        for (const auto& rule : rules) {
+          if (rule->match(tlv::Data, packets[i].getName(), states[i])) {
+            linearResults[i] = rule.get();
+            break;
+          }
+        }
+      }
+    }
+  });
+
+  std::vector<const Rule*> indexedResults(nPackets);
+  auto d2 = timedExecute([&] {
+    for (int j = 0; j < N_ITERATIONS; ++j) {
+      for (size_t i = 0; i < nPackets; ++i) {
+        indexedResults[i] = index.match(tlv::Data, packets[i].getName(), states[i]);
+      }
+    }
+  });
+
+  BOOST_CHECK(linearResults == indexedResults);
+  BOOST_CHECK(std::find(indexedResults.begin(), indexedResults.end(), nullptr) == indexedResults.end());
+
+  const double nLookups = static_cast<double>(nPackets) * N_ITERATIONS;
+  std::cout << rules.size() << " rules, linear: " << d1 << ", "
+            << nLookups / time::duration_cast<time::microseconds>(d1).count() * 1e6 << " lookups/s"
+            << std::endl;
+  std::cout << rules.size() << " rules, indexed: " << d2 << ", "
+            << nLookups / time::duration_cast<time::microseconds>(d2).count() * 1e6 << " lookups/s"
+            << std::endl;
+}
+
+} // namespace tests
+} // namespace validator_config
+} // namespace security
+} // namespace ndn
@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Validator Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/security/certificate-fetcher-offline.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/security/validation-policy-simple-hierarchy.hpp"
+#include "ndn-cxx/security/validator.hpp"
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <iostream>
+#include <thread>
+
+namespace ndn {
+namespace security {
+namespace tests {
+
+using namespace ndn::tests;
+
+// Signature verifications per second when validating Data packets one at a time, and in batches
+// with signatures verified on a varying number of worker threads.
+// For accurate results, it is required to compile ndn-cxx in release mode.
+BOOST_AUTO_TEST_CASE(VerifyBatch)
+{
+  const size_t nPackets = 20000;
+  const size_t batchSize = 1000;
+
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  boost::asio::io_service io;
+
+  for (KeyType keyType : {KeyType::EC, KeyType::RSA}) {
+    Identity identity = keyType == KeyType::EC ?
+                        keyChain.createIdentity("/benchmark/validator", EcKeyParams()) :
+                        keyChain.createIdentity("/benchmark/validator", RsaKeyParams());
+    std::vector<Data> packets(nPackets);
+    for (size_t i = 0; i < nPackets; ++i) {
+      packets[i].setName(Name("/benchmark/validator/data").appendSegment(i));
+      keyChain.sign(packets[i], signingByIdentity(identity));
+    }
+
+    Validator validator(make_unique<ValidationPolicySimpleHierarchy>(),
+                        make_unique<CertificateFetcherOffline>());
+    validator.loadAnchor("", Certificate(identity.getDefaultKey().getDefaultCertificate()));
+
+    size_t nValid = 0;
+    auto onSuccess = [&] (const Data&) { ++nValid; };
+    auto onFailure = [] (const Data&, const ValidationError& error) {
+      BOOST_ERROR("validation failed: " << error);
+    };
+    auto waitForResults = [&] {
+      while (nValid < nPackets) {
+        if (io.poll() == 0) {
+          std::this_thread::yield();
+        }
+        io.reset();
+      }
+    };
+
+    auto d = timedExecute([&] {
+      for (const auto& data : packets) {
+        validator.validate(data, onSuccess, onFailure);
+      }
+    });
+    BOOST_CHECK_EQUAL(nValid, nPackets);
+    std::cout << keyType << " validate one at a time: " << d << ", "
+              << static_cast<uint64_t>(nPackets / (d.count() / 1e9)) << " verifies/s" << std::endl;
+
+    for (size_t nThreads : {0, 1, 2, 4, 8}) {
+      validator.setVerificationThreads(io, nThreads);
+      nValid = 0;
+
+      d = timedExecute([&] {
+        for (size_t i = 0; i < nPackets; i += batchSize) {
+          std::vector<Data> batch(packets.begin() + i, packets.begin() + i + batchSize);
+          validator.validate(batch, onSuccess, onFailure);
+        }
+        waitForResults();
+      });
+      BOOST_CHECK_EQUAL(nValid, nPackets);
+      std::cout << keyType << " validate in batches of " << batchSize << " with "
+                << nThreads << " threads: " << d << ", "
+                << static_cast<uint64_t>(nPackets / (d.count() / 1e9)) << " verifies/s" << std::endl;
+    }
+
+    keyChain.deleteIdentity(identity);
+  }
+}
+
+} // namespace tests
+} // namespace security
+} // namespace ndn
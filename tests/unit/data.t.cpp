@@ -390,6 +390,69 @@ BOOST_AUTO_TEST_CASE(UnrecognizedCriticalElement)
                         [] (const auto& e) { return e.what() == "Unrecognized element of critical type 251"s; });
 }
 
+BOOST_AUTO_TEST_CASE(Lazy)
+{
+  class EnableLazyDecoding
+  {
+  public:
+    EnableLazyDecoding()
+      : m_saved(Data::getLazyDecoding())
+    {
+      Data::setLazyDecoding(true);
+    }
+
+    ~EnableLazyDecoding()
+    {
+      Data::setLazyDecoding(m_saved);
+    }
+
+  private:
+    bool m_saved;
+  } enabler;
+
+  d.wireDecode(Block(DATA1, sizeof(DATA1)));
+  BOOST_CHECK_EQUAL(d.getName(), "/local/ndn/prefix");
+  BOOST_CHECK_EQUAL(d.hasContent(), true);
+  BOOST_CHECK_EQUAL(d.getSignatureValue().value_size(), 128);
+  BOOST_CHECK_EQUAL(d.wireEncode(), Block(DATA1, sizeof(DATA1)));
+  BOOST_CHECK_EQUAL(d.getFreshnessPeriod(), 10_s);
+  BOOST_CHECK_EQUAL(d.getSignatureType(), tlv::SignatureSha256WithRsa);
+  BOOST_REQUIRE(d.getKeyLocator().has_value());
+  BOOST_CHECK_EQUAL(d.getKeyLocator()->getName(), "/test/key/locator");
+  BOOST_CHECK_EQUAL(d.hasMalformedElement(), false);
+
+  // deferred elements are preserved when the Data is modified
+  d.wireDecode(Block(DATA1, sizeof(DATA1)));
+  d.setName("/E");
+  BOOST_CHECK_EQUAL(d.getFreshnessPeriod(), 10_s);
+  BOOST_CHECK_EQUAL(d.getKeyLocator()->getName(), "/test/key/locator");
+  d.wireDecode(Block(DATA1, sizeof(DATA1)));
+  d.setFinalBlock(name::Component("F"));
+  BOOST_CHECK_EQUAL(Data(d.wireEncode()).getFreshnessPeriod(), 10_s);
+
+  // malformed MetaInfo and SignatureInfo are reported on access, not by wireDecode
+  BOOST_CHECK_NO_THROW(d.wireDecode("062F 0703(080144) 1402(1900) 1602(FC00) "
+                                    "1720612A79399E60304A9F701C1ECAC7956BF2F1B046E6C6F0D6C29B3FE3A29BAD76"_block));
+  BOOST_CHECK_EQUAL(d.getName(), "/D");
+  Data copy(d);
+  BOOST_CHECK_EQUAL(d.hasMalformedElement(), true);
+  BOOST_CHECK_EQUAL(d.getFreshnessPeriod(), DEFAULT_FRESHNESS_PERIOD);
+  BOOST_CHECK_EQUAL(d.getSignatureType(), -1);
+  BOOST_CHECK_EQUAL(d.getKeyLocator().has_value(), false);
+  BOOST_CHECK_THROW(d.setFreshnessPeriod(1_s), tlv::Error);
+  d.setName("/E");
+  BOOST_CHECK_THROW(d.wireEncode(), tlv::Error);
+  d.setMetaInfo(MetaInfo().setFreshnessPeriod(1_s));
+  BOOST_CHECK_EQUAL(d.getFreshnessPeriod(), 1_s);
+  BOOST_CHECK_EQUAL(d.hasMalformedElement(), true); // SignatureInfo is still malformed
+  BOOST_CHECK_THROW(d.wireEncode(), tlv::Error);
+
+  // errors are preserved in a copy made before the deferred element was accessed
+  BOOST_CHECK_EQUAL(copy.hasMalformedElement(), true);
+  BOOST_CHECK_EQUAL(copy.getSignatureType(), -1);
+  BOOST_CHECK_THROW(copy.setFreshnessPeriod(1_s), tlv::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Decode
 
 BOOST_FIXTURE_TEST_CASE(FullName, KeyChainFixture)
@@ -402,7 +465,9 @@ BOOST_FIXTURE_TEST_CASE(FullName, KeyChainFixture)
 
   m_keyChain.sign(d);
   BOOST_CHECK_EQUAL(d.hasWire(), true);
+  BOOST_CHECK_EQUAL(d.hasFullName(), false);
   Name fullName = d.getFullName(); // FullName is available after signing
+  BOOST_CHECK_EQUAL(d.hasFullName(), true);
 
   BOOST_CHECK_EQUAL(d.getName().size() + 1, fullName.size());
   BOOST_CHECK_EQUAL_COLLECTIONS(d.getName().begin(), d.getName().end(),
@@ -413,6 +478,7 @@ BOOST_FIXTURE_TEST_CASE(FullName, KeyChainFixture)
   BOOST_CHECK_EQUAL(fullName.get(-1).value(), d.getFullName().get(-1).value());
 
   d.setFreshnessPeriod(100_s); // invalidates FullName
+  BOOST_CHECK_EQUAL(d.hasFullName(), false);
   BOOST_CHECK_THROW(d.getFullName(), Data::Error);
 
   Data d1(Block(DATA1, sizeof(DATA1)));
@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/deferred-element.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace detail {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Detail)
+BOOST_AUTO_TEST_SUITE(TestDeferredElement)
+
+class CountingElement
+{
+public:
+  void
+  wireDecode(const Block& wire)
+  {
+    ++nDecodes;
+    value = readNonNegativeInteger(wire);
+  }
+
+public:
+  static int nDecodes;
+  uint64_t value = 0;
+};
+
+int CountingElement::nDecodes = 0;
+
+BOOST_AUTO_TEST_CASE(CopyKeepsDeferred)
+{
+  CountingElement::nDecodes = 0;
+  DeferredElement<CountingElement> elem;
+  elem.defer(makeNonNegativeIntegerBlock(tlv::Content, 42));
+
+  DeferredElement<CountingElement> copy(elem);
+  DeferredElement<CountingElement> assigned;
+  assigned = elem;
+  BOOST_CHECK_EQUAL(CountingElement::nDecodes, 0);
+  BOOST_CHECK(copy.isDeferred());
+  BOOST_CHECK(assigned.isDeferred());
+
+  BOOST_CHECK_EQUAL(copy.get().value, 42);
+  BOOST_CHECK_EQUAL(assigned.get().value, 42);
+  BOOST_CHECK_EQUAL(CountingElement::nDecodes, 2);
+  BOOST_CHECK(elem.isDeferred());
+
+  // a copy of a decoded element is not decoded again
+  DeferredElement<CountingElement> copyOfDecoded(copy);
+  BOOST_CHECK(!copyOfDecoded.isDeferred());
+  BOOST_CHECK_EQUAL(copyOfDecoded.get().value, 42);
+  BOOST_CHECK_EQUAL(CountingElement::nDecodes, 2);
+}
+
+BOOST_AUTO_TEST_CASE(CopyMalformed)
+{
+  DeferredElement<CountingElement> elem;
+  elem.defer(makeStringBlock(tlv::Content, "not a number"));
+
+  DeferredElement<CountingElement> copy(elem);
+  BOOST_CHECK_EQUAL(copy.hasError(), true);
+  BOOST_CHECK_EQUAL(copy.get().value, 0);
+  BOOST_CHECK_THROW(copy.modify(), tlv::Error);
+
+  BOOST_CHECK_EQUAL(elem.hasError(), true);
+  DeferredElement<CountingElement> copyOfFailed(elem);
+  BOOST_CHECK_EQUAL(copyOfFailed.hasError(), true);
+  BOOST_CHECK_THROW(copyOfFailed.modify(), tlv::Error);
+
+  copyOfFailed.set(CountingElement());
+  BOOST_CHECK_EQUAL(copyOfFailed.hasError(), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDeferredElement
+BOOST_AUTO_TEST_SUITE_END() // Detail
+
+} // namespace tests
+} // namespace detail
+} // namespace ndn
@@ -415,6 +415,13 @@ BOOST_AUTO_TEST_CASE(Parse)
   BOOST_CHECK_EQUAL(data.elements_size(), 5);
   BOOST_CHECK_EQUAL(data.elements().at(0).type(), 0x07);
   BOOST_CHECK_EQUAL(data.elements().at(0).elements().size(), 0); // parse is not recursive
+  BOOST_CHECK(data.elements().at(0).getBuffer() == data.getBuffer());
+  std::vector<uint32_t> types;
+  for (const auto& element : data.elements()) {
+    types.push_back(element.type());
+  }
+  std::vector<uint32_t> expectedTypes{0x07, 0x14, 0x15, 0x16, 0x17};
+  BOOST_CHECK_EQUAL_COLLECTIONS(types.begin(), types.end(), expectedTypes.begin(), expectedTypes.end());
 
   BOOST_CHECK(data.get(0x15) == data.elements().at(2));
   BOOST_CHECK_THROW(data.get(0x01), Block::Error);
@@ -428,6 +435,14 @@ BOOST_AUTO_TEST_CASE(Parse)
   };
   Block bad(MALFORMED, sizeof(MALFORMED));
   BOOST_CHECK_THROW(bad.parse(), Block::Error);
+
+  const uint8_t MALFORMED_LAST[] = {
+    // only the last nested element exceeds TLV-LENGTH of enclosing element
+    0x05, 0x06, 0x08, 0x01, 0x31, 0x08, 0x05, 0x68
+  };
+  Block bad2(MALFORMED_LAST, sizeof(MALFORMED_LAST));
+  BOOST_CHECK_THROW(bad2.parse(), Block::Error);
+  BOOST_CHECK_EQUAL(bad2.elements_size(), 0);
 }
 
 BOOST_AUTO_TEST_CASE(InsertBeginning)
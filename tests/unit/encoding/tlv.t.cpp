@@ -435,6 +435,46 @@ BOOST_AUTO_TEST_CASE(Read)
 
 BOOST_AUTO_TEST_SUITE_END() // Type
 
+BOOST_AUTO_TEST_CASE(IndexElements)
+{
+  const uint8_t BUFFER[] = {
+    0x07, 0x03, 0x08, 0x01, 0x41, // one-octet TLV-TYPE and TLV-LENGTH
+    0xfd, 0x03, 0x20, 0x00, // three-octet TLV-TYPE, empty TLV-VALUE
+    0x15, 0xfd, 0x00, 0x02, 0xc0, 0xc1, // three-octet TLV-LENGTH
+    0x00, 0x00, // illegal TLV-TYPE
+  };
+
+  std::vector<ElementIndexEntry> index;
+  BOOST_CHECK_EQUAL(indexElements(BUFFER, 15, std::back_inserter(index)), 15);
+  BOOST_REQUIRE_EQUAL(index.size(), 3);
+  BOOST_CHECK_EQUAL(index[0].type, 0x07);
+  BOOST_CHECK_EQUAL(index[0].begin, 0);
+  BOOST_CHECK_EQUAL(index[0].valueBegin, 2);
+  BOOST_CHECK_EQUAL(index[0].end, 5);
+  BOOST_CHECK_EQUAL(index[1].type, 0x0320);
+  BOOST_CHECK_EQUAL(index[1].begin, 5);
+  BOOST_CHECK_EQUAL(index[1].valueBegin, 9);
+  BOOST_CHECK_EQUAL(index[1].end, 9);
+  BOOST_CHECK_EQUAL(index[2].type, 0x15);
+  BOOST_CHECK_EQUAL(index[2].begin, 9);
+  BOOST_CHECK_EQUAL(index[2].valueBegin, 13);
+  BOOST_CHECK_EQUAL(index[2].end, 15);
+
+  // indexing stops before an incomplete or malformed element
+  for (size_t size : {1, 4, 6, 8, 10, 12, 14}) {
+    index.clear();
+    size_t nIndexed = indexElements(BUFFER, size, std::back_inserter(index));
+    BOOST_CHECK_LT(nIndexed, size);
+    BOOST_CHECK_EQUAL(nIndexed, index.empty() ? 0 : index.back().end);
+  }
+  index.clear();
+  BOOST_CHECK_EQUAL(indexElements(BUFFER, sizeof(BUFFER), std::back_inserter(index)), 15);
+  BOOST_CHECK_EQUAL(index.size(), 3);
+  index.clear();
+  BOOST_CHECK_EQUAL(indexElements(BUFFER, 0, std::back_inserter(index)), 0);
+  BOOST_CHECK_EQUAL(index.size(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE(NonNegativeInteger)
 
 // This check ensures readNonNegativeInteger only requires InputIterator concept and nothing more.
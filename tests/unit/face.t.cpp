@@ -31,6 +31,9 @@
 
 #include <boost/logic/tribool.hpp>
 
+#include <atomic>
+#include <thread>
+
 namespace ndn {
 namespace tests {
 
@@ -147,6 +150,34 @@ BOOST_AUTO_TEST_CASE(MultipleData)
   BOOST_CHECK_EQUAL(face.sentData.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(DataMatching)
+{
+  auto data = makeData("/Hello/World/a");
+  std::vector<std::string> satisfied;
+  auto expressInterest = [&] (const Name& name, bool canBePrefix, const std::string& label) {
+    face.expressInterest(*makeInterest(name, canBePrefix, 50_ms),
+                         [&satisfied, label] (const auto&, const auto&) { satisfied.push_back(label); },
+                         nullptr, nullptr);
+  };
+
+  expressInterest("/Hello/World/a", false, "exact");
+  expressInterest("/Hello/World", false, "shorter-exact");
+  expressInterest("/Hello", true, "prefix");
+  expressInterest("/Hello/World/a", true, "exact-prefix");
+  expressInterest("/Hello/World/a/b", true, "longer-prefix");
+  expressInterest(data->getFullName(), false, "full-name");
+  expressInterest(Name("/Hello/World/b").append(data->getFullName().get(-1)), false, "other-full-name");
+  advanceClocks(1_ms);
+
+  face.receive(*data);
+  advanceClocks(1_ms);
+
+  // callbacks are invoked in the order the Interests were expressed
+  std::vector<std::string> expected{"exact", "prefix", "exact-prefix", "full-name"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(satisfied.begin(), satisfied.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 3);
+}
+
 BOOST_AUTO_TEST_CASE(EmptyDataCallback)
 {
   face.expressInterest(*makeInterest("/Hello/World", true),
@@ -514,6 +545,113 @@ BOOST_AUTO_TEST_CASE(PutMultipleNackLoopback)
 
 BOOST_AUTO_TEST_SUITE_END() // Producer
 
+BOOST_AUTO_TEST_SUITE(Submit)
+
+BOOST_AUTO_TEST_CASE(InterestsFromThreads)
+{
+  const size_t N_THREADS = 4;
+  const size_t N_INTERESTS = 100;
+
+  std::atomic<size_t> nData{0};
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < N_THREADS; ++t) {
+    threads.emplace_back([&, t] {
+      for (size_t i = 0; i < N_INTERESTS; ++i) {
+        face.submitInterest(*makeInterest(Name("/submit").appendNumber(t).appendNumber(i)),
+                            [&] (const auto&, const auto&) { ++nData; },
+                            nullptr, nullptr);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), N_THREADS * N_INTERESTS);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), N_THREADS * N_INTERESTS);
+
+  // Interests submitted by the same thread are sent in order
+  std::vector<uint64_t> lastSeq(N_THREADS, 0);
+  for (const auto& interest : face.sentInterests) {
+    auto t = interest.getName().at(1).toNumber();
+    auto i = interest.getName().at(2).toNumber();
+    BOOST_CHECK_EQUAL(i, lastSeq[t]);
+    lastSeq[t] = i + 1;
+    face.receive(*makeData(interest.getName()));
+  }
+  BOOST_CHECK_EQUAL(nData, N_THREADS * N_INTERESTS);
+}
+
+BOOST_AUTO_TEST_CASE(Executor)
+{
+  std::vector<std::function<void()>> deferred;
+  auto executor = [&deferred] (std::function<void()> f) { deferred.push_back(std::move(f)); };
+
+  size_t nData = 0, nTimeouts = 0;
+  face.submitInterest(*makeInterest("/submit/data"),
+                      [&] (const Interest& i, const Data& d) {
+                        BOOST_CHECK_EQUAL(i.getName(), "/submit/data");
+                        BOOST_CHECK_EQUAL(d.getName(), "/submit/data");
+                        ++nData;
+                      },
+                      nullptr, nullptr, executor);
+  face.submitInterest(*makeInterest("/submit/timeout", false, 50_ms),
+                      nullptr, nullptr, [&] (const Interest&) { ++nTimeouts; }, executor);
+  advanceClocks(1_ms);
+
+  face.receive(*makeData("/submit/data"));
+  advanceClocks(10_ms, 10);
+  BOOST_CHECK_EQUAL(nData, 0);
+  BOOST_CHECK_EQUAL(nTimeouts, 0);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+
+  // the callbacks are invoked by the executor, with copies of their arguments
+  BOOST_REQUIRE_EQUAL(deferred.size(), 2);
+  for (const auto& f : deferred) {
+    f();
+  }
+  BOOST_CHECK_EQUAL(nData, 1);
+  BOOST_CHECK_EQUAL(nTimeouts, 1);
+}
+
+BOOST_AUTO_TEST_CASE(Cancel)
+{
+  auto hdl = face.submitInterest(*makeInterest("/submit/cancel"),
+                                 bind([] { BOOST_FAIL("Unexpected Data"); }), nullptr, nullptr);
+  std::thread([&hdl] { hdl.cancel(); }).join();
+
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+  face.receive(*makeData("/submit/cancel"));
+  advanceClocks(1_ms);
+}
+
+BOOST_AUTO_TEST_CASE(DataAndNack)
+{
+  face.setInterestFilter("/", bind([]{}));
+  advanceClocks(1_ms);
+  auto interest = makeInterest("/submit/nack", false, nullopt, 14247162);
+  face.receive(*interest);
+  advanceClocks(1_ms);
+
+  std::thread([&] {
+    face.submitData(*makeData("/submit/data"));
+    face.submitNack(makeNack(*interest, lp::NackReason::DUPLICATE));
+  }).join();
+
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentData[0].getName(), "/submit/data");
+  BOOST_REQUIRE_EQUAL(face.sentNacks.size(), 1);
+  BOOST_CHECK_EQUAL(face.sentNacks[0].getReason(), lp::NackReason::DUPLICATE);
+
+  Data unsignedData("/submit/unsigned");
+  BOOST_CHECK_THROW(face.submitData(unsignedData), tlv::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Submit
+
 BOOST_AUTO_TEST_SUITE(RegisterPrefix)
 
 BOOST_FIXTURE_TEST_CASE(Failure, FaceFixture<NoPrefixRegReply>)
@@ -713,6 +851,31 @@ BOOST_AUTO_TEST_CASE(SimilarFilters)
   BOOST_CHECK_EQUAL(nInInterests3, 0);
 }
 
+BOOST_AUTO_TEST_CASE(DispatchOrder)
+{
+  std::vector<int> invoked;
+  auto makeCallback = [&invoked] (int i) {
+    return [&invoked, i] (const auto&, const auto&) { invoked.push_back(i); };
+  };
+
+  face.setInterestFilter("/Hello/World", makeCallback(1));
+  face.setInterestFilter("/", makeCallback(2));
+  face.setInterestFilter("/Hello", makeCallback(3));
+  face.setInterestFilter(InterestFilter("/Hello", "<World><>"), makeCallback(4));
+  face.setInterestFilter(InterestFilter("/Hello", "<Moon><>"), makeCallback(5));
+  auto handle = face.setInterestFilter("/Hello", makeCallback(6));
+  face.setInterestFilter("/Hello/World/%21/b", makeCallback(7));
+  handle.cancel();
+  advanceClocks(25_ms, 4);
+
+  face.receive(*makeInterest("/Hello/World/%21"));
+  advanceClocks(25_ms, 4);
+
+  // all matching filters are invoked in the order they were set
+  std::vector<int> expected{1, 2, 3, 4};
+  BOOST_CHECK_EQUAL_COLLECTIONS(invoked.begin(), invoked.end(), expected.begin(), expected.end());
+}
+
 BOOST_AUTO_TEST_CASE(RegexFilter)
 {
   size_t nInInterests = 0;
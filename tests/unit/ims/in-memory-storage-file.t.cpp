@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-file.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <boost/filesystem.hpp>
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Ims)
+
+class InMemoryStorageFileFixture
+{
+protected:
+  InMemoryStorageFileFixture()
+    : logPath(boost::filesystem::path(UNIT_TESTS_TMPDIR) / "ims-file" / "packets.log")
+    , logFile(logPath.string())
+  {
+    boost::filesystem::create_directories(logPath.parent_path());
+    boost::filesystem::remove(logPath);
+  }
+
+  ~InMemoryStorageFileFixture()
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove_all(logPath.parent_path(), ec); // ignore error
+  }
+
+protected:
+  const boost::filesystem::path logPath;
+  const std::string logFile;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestInMemoryStorageFile, InMemoryStorageFileFixture)
+
+BOOST_AUTO_TEST_CASE(Recover)
+{
+  auto data1 = makeData("/file/1");
+  auto data2 = makeData("/file/2");
+  auto data3 = makeData("/file/3");
+  {
+    InMemoryStorageFile ims(logFile);
+    BOOST_CHECK_EQUAL(ims.size(), 0);
+    ims.insert(*data1);
+    ims.insert(*data2);
+    ims.insert(*data3);
+    ims.insert(*data1); // duplicate is not logged again
+    ims.erase(data2->getFullName(), false);
+    BOOST_CHECK_EQUAL(ims.size(), 2);
+  }
+  size_t logSize = boost::filesystem::file_size(logPath);
+  BOOST_CHECK_EQUAL(logSize, data1->wireEncode().size() + data2->wireEncode().size() +
+                             data3->wireEncode().size() + data2->getFullName().wireEncode().size());
+
+  InMemoryStorageFile ims(logFile);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK_EQUAL(boost::filesystem::file_size(logPath), logSize);
+
+  auto found = ims.find(*makeInterest("/file/1"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->wireEncode(), data1->wireEncode());
+  BOOST_CHECK(ims.find(*makeInterest("/file/2")) == nullptr);
+  BOOST_CHECK(ims.find(*makeInterest(data3->getFullName())) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(TruncatedTail)
+{
+  auto data1 = makeData("/file/1");
+  auto data2 = makeData("/file/2");
+  {
+    InMemoryStorageFile ims(logFile);
+    ims.insert(*data1);
+    ims.insert(*data2);
+  }
+  size_t data1Size = data1->wireEncode().size();
+  boost::filesystem::resize_file(logPath, data1Size + data2->wireEncode().size() - 1);
+
+  {
+    InMemoryStorageFile ims(logFile);
+    BOOST_CHECK_EQUAL(ims.size(), 1);
+    BOOST_CHECK(ims.find(*makeInterest("/file/1")) != nullptr);
+    BOOST_CHECK_EQUAL(boost::filesystem::file_size(logPath), data1Size);
+
+    // appending after recovery yields a consistent log
+    ims.insert(*data2);
+  }
+
+  InMemoryStorageFile ims(logFile);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Compact)
+{
+  auto data1 = makeData("/file/1");
+  auto data2 = makeData("/file/2");
+  {
+    InMemoryStorageFile ims(logFile);
+    ims.compact(); // empty storage
+    BOOST_CHECK_EQUAL(boost::filesystem::file_size(logPath), 0);
+
+    ims.insert(*data1);
+    ims.insert(*data2);
+    ims.erase("/file/1");
+    ims.compact();
+    BOOST_CHECK_EQUAL(boost::filesystem::file_size(logPath), data2->wireEncode().size());
+
+    ims.insert(*data1);
+  }
+
+  InMemoryStorageFile ims(logFile);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(OpenError)
+{
+  boost::filesystem::create_directories(logPath); // a directory cannot be opened as the log
+  BOOST_CHECK_THROW(InMemoryStorageFile{logFile}, InMemoryStorageFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageFile
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace tests
+} // namespace ndn
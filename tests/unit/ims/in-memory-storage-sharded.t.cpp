@@ -0,0 +1,194 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-sharded.hpp"
+#include "ndn-cxx/ims/in-memory-storage-lru.hpp"
+#include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Ims)
+BOOST_AUTO_TEST_SUITE(TestInMemoryStorageSharded)
+
+class ShardedFixture
+{
+protected:
+  ShardedFixture()
+    : ims(4, [] { return make_unique<InMemoryStoragePersistent>(); })
+  {
+    for (int i = 0; i < 32; ++i) {
+      auto data = makeData(Name("/sharded").appendSegment(i));
+      ims.insert(*data);
+      packets.push_back(std::move(data));
+    }
+  }
+
+protected:
+  InMemoryStorageSharded ims;
+  std::vector<shared_ptr<Data>> packets;
+};
+
+BOOST_FIXTURE_TEST_CASE(Distribution, ShardedFixture)
+{
+  BOOST_CHECK_EQUAL(ims.getNShards(), 4);
+  BOOST_CHECK_EQUAL(ims.size(), 32);
+
+  std::set<size_t> shards;
+  for (const auto& data : packets) {
+    shards.insert(ims.getShardIndex(data->getName()));
+  }
+  BOOST_CHECK_GT(shards.size(), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(FindExact, ShardedFixture)
+{
+  for (const auto& data : packets) {
+    auto found = ims.find(*makeInterest(data->getName()));
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(found->getFullName(), data->getFullName());
+
+    found = ims.find(*makeInterest(data->getFullName()));
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(found->getFullName(), data->getFullName());
+  }
+
+  BOOST_CHECK(ims.find(*makeInterest("/sharded")) == nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(FindPrefix, ShardedFixture)
+{
+  // the leftmost match across all shards is returned
+  auto found = ims.find(*makeInterest("/sharded", true));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), packets.front()->getName());
+
+  found = ims.find(Name("/sharded"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getName(), packets.front()->getName());
+
+  BOOST_CHECK(ims.find(*makeInterest("/other", true)) == nullptr);
+}
+
+class AccessCountingStorage : public InMemoryStoragePersistent
+{
+public:
+  explicit
+  AccessCountingStorage(std::vector<Name>& accessed)
+    : m_accessed(accessed)
+  {
+  }
+
+private:
+  void
+  afterAccess(InMemoryStorageEntry* entry) final
+  {
+    m_accessed.push_back(entry->getName());
+  }
+
+private:
+  std::vector<Name>& m_accessed;
+};
+
+BOOST_AUTO_TEST_CASE(FindPrefixAccess)
+{
+  std::vector<Name> accessed;
+  InMemoryStorageSharded ims(4, [&] { return make_unique<AccessCountingStorage>(accessed); });
+  for (int i = 0; i < 32; ++i) {
+    ims.insert(*makeData(Name("/access").appendSegment(i)));
+  }
+  BOOST_REQUIRE(accessed.empty());
+
+  // only the shard whose Data is returned sees the access
+  auto found = ims.find(*makeInterest("/access", true));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_REQUIRE_EQUAL(accessed.size(), 1);
+  BOOST_CHECK_EQUAL(accessed.front(), found->getName());
+
+  accessed.clear();
+  found = ims.find(Name("/access"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_REQUIRE_EQUAL(accessed.size(), 1);
+  BOOST_CHECK_EQUAL(accessed.front(), found->getName());
+
+  accessed.clear();
+  BOOST_CHECK(ims.find(*makeInterest("/other", true)) == nullptr);
+  BOOST_CHECK(accessed.empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(Erase, ShardedFixture)
+{
+  ims.erase(packets[3]->getFullName(), false);
+  BOOST_CHECK_EQUAL(ims.size(), 31);
+  BOOST_CHECK(ims.find(*makeInterest(packets[3]->getName())) == nullptr);
+
+  ims.erase("/sharded");
+  BOOST_CHECK_EQUAL(ims.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ShardLimit)
+{
+  InMemoryStorageSharded ims(2, [] { return make_unique<InMemoryStorageLru>(5); });
+  for (int i = 0; i < 100; ++i) {
+    ims.insert(*makeData(Name("/limit").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(ims.size(), 10);
+}
+
+BOOST_FIXTURE_TEST_CASE(ConcurrentFind, ShardedFixture)
+{
+  std::vector<shared_ptr<Interest>> interests;
+  for (const auto& data : packets) {
+    interests.push_back(makeInterest(data->getName()));
+    interests.back()->getName().getHash(); // warm up the cache, so that threads only read the Interest
+  }
+
+  std::vector<size_t> nFound(4, 0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < nFound.size(); ++t) {
+    threads.emplace_back([&, t] {
+      for (int round = 0; round < 100; ++round) {
+        for (const auto& interest : interests) {
+          nFound[t] += ims.find(*interest) != nullptr;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t n : nFound) {
+    BOOST_CHECK_EQUAL(n, 100 * packets.size());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageSharded
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/ims/in-memory-storage-tinylfu.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::tests;
+
+BOOST_AUTO_TEST_SUITE(Ims)
+BOOST_AUTO_TEST_SUITE(TestInMemoryStorageTinyLfu)
+
+using Segment = InMemoryStorageTinyLfu::Segment;
+
+BOOST_AUTO_TEST_CASE(FrequencySketch)
+{
+  InMemoryStorageTinyLfu::FrequencySketch sketch;
+  BOOST_CHECK_EQUAL(sketch.estimate(1), 0);
+
+  sketch.ensureCapacity(10);
+  for (int i = 0; i < 10; ++i) {
+    sketch.increment(1);
+  }
+  BOOST_CHECK_EQUAL(sketch.estimate(1), 10);
+  BOOST_CHECK_LE(sketch.estimate(2), 10);
+
+  for (int i = 0; i < 10; ++i) {
+    sketch.increment(1);
+  }
+  BOOST_CHECK_EQUAL(sketch.estimate(1), InMemoryStorageTinyLfu::FrequencySketch::MAX_COUNT);
+
+  // counters are halved after 10 increments per entry the sketch is sized for
+  for (size_t i = 100; i < 100 + 10 * 16; ++i) {
+    sketch.increment(i);
+  }
+  BOOST_CHECK_LT(sketch.estimate(1), InMemoryStorageTinyLfu::FrequencySketch::MAX_COUNT);
+  BOOST_CHECK_GE(sketch.estimate(1), InMemoryStorageTinyLfu::FrequencySketch::MAX_COUNT / 2);
+}
+
+BOOST_AUTO_TEST_CASE(Segments)
+{
+  InMemoryStorageTinyLfu ims(100);
+
+  ims.insert(*makeData("/segment/1"));
+  BOOST_CHECK(ims.getSegment("/segment/1") == Segment::WINDOW);
+
+  ims.insert(*makeData("/segment/2"));
+  BOOST_CHECK(ims.getSegment("/segment/1") == Segment::PROBATION);
+  BOOST_CHECK(ims.getSegment("/segment/2") == Segment::WINDOW);
+
+  ims.find("/segment/1");
+  BOOST_CHECK(ims.getSegment("/segment/1") == Segment::PROTECTED);
+
+  ims.erase("/segment/2");
+  BOOST_CHECK(ims.getSegment("/segment/2") == Segment::NONE);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ScanResistance)
+{
+  InMemoryStorageTinyLfu ims(100);
+
+  for (int i = 0; i < 90; ++i) {
+    ims.insert(*makeData(Name("/popular").appendNumber(i)));
+  }
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 90; ++i) {
+      BOOST_REQUIRE(ims.find(Name("/popular").appendNumber(i)) != nullptr);
+    }
+  }
+
+  // packets requested only once do not displace popular packets
+  for (int i = 0; i < 200; ++i) {
+    ims.insert(*makeData(Name("/scan").appendNumber(i)));
+  }
+  BOOST_CHECK_EQUAL(ims.size(), 100);
+  size_t nPopular = 0;
+  for (int i = 0; i < 90; ++i) {
+    nPopular += ims.find(Name("/popular").appendNumber(i)) != nullptr;
+  }
+  BOOST_CHECK_EQUAL(nPopular, 90);
+  BOOST_CHECK(ims.find(Name("/scan").appendNumber(199)) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(AdmitPopular)
+{
+  InMemoryStorageTinyLfu ims(10);
+
+  for (int i = 0; i < 10; ++i) {
+    ims.insert(*makeData(Name("/old").appendNumber(i)));
+  }
+
+  // a packet that was requested often before being evicted is admitted when inserted again
+  Name name("/new");
+  for (int i = 0; i < 3; ++i) {
+    ims.insert(*makeData(name));
+    BOOST_REQUIRE(ims.find(name) != nullptr);
+    ims.erase(name);
+  }
+  ims.insert(*makeData(name));
+  ims.insert(*makeData("/next"));
+  BOOST_CHECK_EQUAL(ims.size(), 10);
+  BOOST_CHECK(ims.find(name) != nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorageTinyLfu
+BOOST_AUTO_TEST_SUITE_END() // Ims
+
+} // namespace tests
+} // namespace ndn
@@ -24,6 +24,7 @@
 #include "ndn-cxx/ims/in-memory-storage-lfu.hpp"
 #include "ndn-cxx/ims/in-memory-storage-lru.hpp"
 #include "ndn-cxx/ims/in-memory-storage-persistent.hpp"
+#include "ndn-cxx/ims/in-memory-storage-tinylfu.hpp"
 #include "ndn-cxx/util/sha256.hpp"
 
 #include "tests/test-common.hpp"
@@ -42,7 +43,8 @@ BOOST_AUTO_TEST_SUITE(TestInMemoryStorage)
 using InMemoryStorages = boost::mpl::vector<InMemoryStoragePersistent,
                                             InMemoryStorageFifo,
                                             InMemoryStorageLfu,
-                                            InMemoryStorageLru>;
+                                            InMemoryStorageLru,
+                                            InMemoryStorageTinyLfu>;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(Insertion, T, InMemoryStorages)
 {
@@ -281,6 +283,53 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(DigestCalculation, T, InMemoryStorages)
                                 entry.getFullName()[-1].value_end());
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(DigestOnDemand, T, InMemoryStorages)
+{
+  T ims;
+
+  auto data1 = makeData("/digest/lazy");
+  auto data2 = makeData("/digest/lazy");
+  uint32_t content2 = 2;
+  data2->setContent(reinterpret_cast<const uint8_t*>(&content2), sizeof(content2));
+  signData(data2);
+  ims.insert(*data1);
+  ims.insert(*data2);
+  ims.insert(*data1); // duplicate is detected without computing digests
+  ims.insert(*makeData("/digest/lazy/child"));
+  BOOST_CHECK_EQUAL(ims.size(), 3);
+  BOOST_CHECK_EQUAL(ims.getNDigestComputations(), 0);
+
+  BOOST_CHECK(ims.find(*makeInterest("/digest/lazy")) != nullptr);
+  BOOST_CHECK(ims.find(*makeInterest("/digest", true)) != nullptr);
+  BOOST_CHECK(ims.find("/digest/lazy/child") != nullptr);
+  BOOST_CHECK_EQUAL(ims.getNDigestComputations(), 0);
+
+  // the stored packets are shared with data1 and data2, so their full names are computed on copies
+  const Name fullName1 = Data(*data1).getFullName();
+  const Name fullName2 = Data(*data2).getFullName();
+  auto found = ims.find(*makeInterest(fullName2));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->getFullName(), fullName2);
+  BOOST_CHECK_LE(ims.getNDigestComputations(), 2);
+  BOOST_CHECK_GE(ims.getNDigestComputations(), 1);
+
+  // digests are computed at most once per stored packet
+  ims.find(fullName1);
+  ims.erase(fullName2, false);
+  BOOST_CHECK_EQUAL(ims.size(), 2);
+  BOOST_CHECK_LE(ims.getNDigestComputations(), 2);
+
+  // a digest cached in the Data packet before insertion is not computed again
+  size_t nDigestComputations = ims.getNDigestComputations();
+  auto data3 = makeData("/digest/cached");
+  BOOST_CHECK(!data3->hasFullName());
+  data3->getFullName();
+  BOOST_CHECK(data3->hasFullName());
+  ims.insert(*data3);
+  BOOST_CHECK(ims.find(*makeInterest(data3->getFullName())) != nullptr);
+  BOOST_CHECK_EQUAL(ims.getNDigestComputations(), nDigestComputations);
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(Iterator, T, InMemoryStorages)
 {
   T ims;
@@ -441,6 +490,81 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(InsertAndEvict, T, InMemoryStoragesLimited)
   BOOST_CHECK(found == nullptr);
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(ByteAccounting, T, InMemoryStorages)
+{
+  T ims;
+  BOOST_CHECK_EQUAL(ims.getByteLimit(), std::numeric_limits<size_t>::max());
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 0);
+
+  auto data1 = makeData("/bytes/1");
+  auto data2 = makeData("/bytes/2");
+  data2->setContent(Buffer(1000).data(), 1000);
+  signData(data2);
+  ims.insert(*data1);
+  ims.insert(*data2);
+  size_t overhead = InMemoryStorage::getEntryOverhead();
+  BOOST_CHECK_GT(overhead, sizeof(Data));
+  BOOST_CHECK_EQUAL(ims.getNBytes(), data1->wireEncode().size() + data2->wireEncode().size() + 2 * overhead);
+  BOOST_CHECK_EQUAL(ims.getNOverheadBytes(), 2 * overhead);
+
+  ims.erase("/bytes/2");
+  BOOST_CHECK_EQUAL(ims.getNBytes(), data1->wireEncode().size() + overhead);
+  ims.erase("/bytes");
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 0);
+  BOOST_CHECK_EQUAL(ims.getNOverheadBytes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ByteLimitEvict, T, InMemoryStoragesLimited)
+{
+  T ims(100);
+  std::vector<shared_ptr<Data>> packets;
+  for (int i = 1; i <= 5; ++i) {
+    packets.push_back(makeData("/bytes/" + to_string(i)));
+  }
+  size_t entrySize = packets[0]->wireEncode().size() + InMemoryStorage::getEntryOverhead();
+
+  ims.setByteLimit(3 * entrySize + entrySize / 2);
+  BOOST_CHECK_EQUAL(ims.getByteLimit(), 3 * entrySize + entrySize / 2);
+  for (const auto& data : packets) {
+    ims.insert(*data);
+  }
+  BOOST_CHECK_EQUAL(ims.size(), 3);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), 3 * entrySize);
+  BOOST_CHECK(ims.find("/bytes/1") == nullptr);
+  BOOST_CHECK(ims.find("/bytes/5") != nullptr);
+
+  // reducing the byte limit evicts packets
+  ims.setByteLimit(entrySize);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK_EQUAL(ims.getNBytes(), entrySize);
+
+  // a packet larger than the byte limit is not inserted
+  auto large = makeData("/bytes/large");
+  large->setContent(Buffer(1000).data(), 1000);
+  signData(large);
+  ims.insert(*large);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK(ims.find("/bytes/large") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ByteLimitPersistent)
+{
+  InMemoryStoragePersistent ims;
+  auto data1 = makeData("/bytes/1");
+  auto data2 = makeData("/bytes/2");
+  size_t entrySize = data1->wireEncode().size() + InMemoryStorage::getEntryOverhead();
+
+  ims.setByteLimit(entrySize);
+  ims.insert(*data1);
+  ims.insert(*data2); // no room, and persistent storage does not evict
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+  BOOST_CHECK(ims.find("/bytes/1") != nullptr);
+  BOOST_CHECK(ims.find("/bytes/2") == nullptr);
+
+  BOOST_CHECK_THROW(ims.setByteLimit(entrySize - 1), InMemoryStorage::Error);
+  BOOST_CHECK_EQUAL(ims.size(), 1);
+}
+
 // Find function is implemented at the base case, so it's sufficient to test for one derived class.
 class FindFixture : public IoFixture
 {
@@ -530,6 +654,26 @@ BOOST_AUTO_TEST_CASE(FullName)
   BOOST_CHECK_EQUAL(find(), 2);
 }
 
+BOOST_AUTO_TEST_CASE(ExactName_SameName)
+{
+  insert(1, "/A");
+  insert(2, "/A");
+  insert(3, "/A/B");
+
+  // the exact-name lookup must select the same packet as the prefix lookup
+  startInterest("/A")
+    .setCanBePrefix(true);
+  uint32_t expected = find();
+  BOOST_CHECK(expected == 1 || expected == 2);
+
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), expected);
+
+  m_ims.erase("/A");
+  startInterest("/A");
+  BOOST_CHECK_EQUAL(find(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(FullName_EmptyDataName)
 {
   Name n1 = insert(1, "/");
@@ -598,6 +742,25 @@ BOOST_AUTO_TEST_CASE(MustBeFresh)
   BOOST_CHECK_EQUAL(find(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(MustBeFreshReusedEntry)
+{
+  auto setFreshness = [] (Data& data) { data.setFreshnessPeriod(1_h); };
+  Name name = insert(1, "/A/1", setFreshness, 1_s);
+  BOOST_CHECK_EQUAL(m_io.poll(), 0); // staleness is evaluated on lookup, not by a timer
+
+  advanceClocks(2_s);
+  startInterest("/A/1").setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 0);
+
+  // the freed entry is reused for the next insertion, which must not inherit the old stale time
+  m_ims.erase(name, false);
+  BOOST_CHECK_EQUAL(m_ims.size(), 0);
+  insert(2, "/A/2", setFreshness);
+  advanceClocks(2_s);
+  startInterest("/A/2").setMustBeFresh(true);
+  BOOST_CHECK_EQUAL(find(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Find
 BOOST_AUTO_TEST_SUITE_END() // TestInMemoryStorage
 BOOST_AUTO_TEST_SUITE_END() // Ims
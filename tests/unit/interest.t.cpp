@@ -47,6 +47,24 @@ private:
   bool m_saved;
 };
 
+class EnableLazyDecoding
+{
+public:
+  EnableLazyDecoding()
+    : m_saved(Interest::getLazyDecoding())
+  {
+    Interest::setLazyDecoding(true);
+  }
+
+  ~EnableLazyDecoding()
+  {
+    Interest::setLazyDecoding(m_saved);
+  }
+
+private:
+  bool m_saved;
+};
+
 BOOST_AUTO_TEST_CASE(DefaultConstructor)
 {
   Interest i;
@@ -648,6 +666,50 @@ BOOST_AUTO_TEST_CASE(UnrecognizedCriticalElement)
                         [] (const auto& e) { return e.what() == "Unrecognized element of critical type 9"s; });
 }
 
+BOOST_AUTO_TEST_CASE(Lazy)
+{
+  EnableLazyDecoding enabler;
+
+  i.wireDecode("0531 0703(080149) "
+               "FC00 2100 FC00 1200 FC00 1E0B(1F09 1E023E15 0703080148) "
+               "FC00 0A044ACB1E4C FC00 0C0276A1 FC00 2201D6 FC00"_block);
+  BOOST_CHECK_EQUAL(i.getName(), "/I");
+  BOOST_CHECK_EQUAL(i.getCanBePrefix(), true);
+  BOOST_CHECK_EQUAL(i.getMustBeFresh(), true);
+  BOOST_CHECK_EQUAL(i.getNonce(), 0x4acb1e4c);
+  BOOST_CHECK_EQUAL(i.getInterestLifetime(), 30369_ms);
+  BOOST_CHECK_EQUAL(*i.getHopLimit(), 214);
+  BOOST_CHECK_EQUAL(i.wireEncode().value_size(), 49);
+  BOOST_CHECK_EQUAL(i.getForwardingHint(), DelegationList({{15893, "/H"}}));
+  BOOST_CHECK_EQUAL(i.hasMalformedElement(), false);
+
+  // deferred ForwardingHint is preserved when the Interest is modified
+  i.wireDecode("0518 0703(080149) 1E0B(1F09 1E023E15 0703080148) 0A044ACB1E4C"_block);
+  i.setName("/J");
+  BOOST_CHECK_EQUAL(i.wireEncode(),
+                    "0518 0703(08014A) 1E0B(1F09 1E023E15 0703080148) 0A044ACB1E4C"_block);
+  i.wireDecode("0518 0703(080149) 1E0B(1F09 1E023E15 0703080148) 0A044ACB1E4C"_block);
+  i.modifyForwardingHint([] (DelegationList& fh) { fh.insert(6, "/G"); });
+  BOOST_CHECK_EQUAL(i.getForwardingHint(), DelegationList({{6, "/G"}, {15893, "/H"}}));
+
+  // malformed ForwardingHint is reported on access, not by wireDecode
+  BOOST_CHECK_NO_THROW(i.wireDecode("050D 0703(080149) 1E00 0A044ACB1E4C"_block));
+  BOOST_CHECK_EQUAL(i.getName(), "/I");
+  Interest copy(i);
+  BOOST_CHECK_EQUAL(i.hasMalformedElement(), true);
+  BOOST_CHECK_EQUAL(i.getForwardingHint().empty(), true);
+  BOOST_CHECK_THROW(i.modifyForwardingHint([] (DelegationList&) {}), tlv::Error);
+  i.setName("/J");
+  BOOST_CHECK_THROW(i.wireEncode(), tlv::Error);
+  i.setForwardingHint({{10309, "/F"}});
+  BOOST_CHECK_EQUAL(i.getForwardingHint(), DelegationList({{10309, "/F"}}));
+  BOOST_CHECK_EQUAL(i.hasMalformedElement(), false);
+
+  // a copy made before the ForwardingHint was accessed reports the error too
+  BOOST_CHECK_EQUAL(copy.hasMalformedElement(), true);
+  BOOST_CHECK_THROW(copy.modifyForwardingHint([] (DelegationList&) {}), tlv::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Decode
 
 BOOST_AUTO_TEST_CASE(MatchesData)
@@ -525,6 +525,43 @@ BOOST_AUTO_TEST_CASE(UnorderedMap)
   BOOST_CHECK_EQUAL(map[name3], 3);
 }
 
+BOOST_AUTO_TEST_CASE(Hash)
+{
+  Name name1("/A/B/C");
+  Name name2;
+  name2.append("A").append("B").append("C"); // no wire encoding
+  BOOST_CHECK_EQUAL(name1.getHash(), name2.getHash());
+  BOOST_CHECK_EQUAL(std::hash<Name>{}(name1), name1.getHash());
+  BOOST_CHECK_NE(Name("/A/B").getHash(), Name("/AB").getHash());
+  BOOST_CHECK_NE(Name("/A").getHash(), Name("/9=A").getHash());
+
+  // cached hash is invalidated when the name is modified
+  size_t hash = name2.getHash();
+  name2.append("D");
+  BOOST_CHECK_NE(name2.getHash(), hash);
+  BOOST_CHECK_EQUAL(name2.getHash(), Name("/A/B/C/D").getHash());
+  name2.set(-1, name::Component("E"));
+  BOOST_CHECK_EQUAL(name2.getHash(), Name("/A/B/C/E").getHash());
+  name2.erase(-1);
+  BOOST_CHECK_EQUAL(name2.getHash(), hash);
+  name2.clear();
+  BOOST_CHECK_EQUAL(name2.getHash(), Name().getHash());
+  name2.wireDecode(name1.wireEncode());
+  BOOST_CHECK_EQUAL(name2.getHash(), hash);
+}
+
+BOOST_AUTO_TEST_CASE(PrefixHash)
+{
+  Name name("/A/B/C/D");
+  for (size_t i = 0; i <= name.size(); ++i) {
+    BOOST_CHECK_EQUAL(name.getPrefixHash(i), name.getPrefix(i).getHash());
+    BOOST_CHECK_EQUAL(Name::hashComponents(name.begin(), name.begin() + i), name.getPrefix(i).getHash());
+  }
+  BOOST_CHECK_EQUAL(name.getPrefixHash(-1), Name("/A/B/C").getHash());
+  BOOST_CHECK_EQUAL(Name::hashComponents(name.begin() + 1, name.begin() + 3), Name("/B/C").getHash());
+  BOOST_CHECK_EQUAL(Name::hashComponents(name.end(), name.end()), Name().getHash());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestName
 
 } // namespace tests
@@ -131,6 +131,113 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateFailure, T, Failures, CertificateFetche
   BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
 }
 
+template<class Response>
+class CoalescingFixture : public CertificateFetcherFromNetworkFixture<Response>
+{
+public:
+  /**
+   * @brief Validates @p nPackets Data packets signed by the same key concurrently
+   * @return number of successfully validated packets, number of failed packets
+   */
+  std::pair<size_t, size_t>
+  validateConcurrently(size_t nPackets)
+  {
+    size_t nSuccesses = 0;
+    size_t nFailures = 0;
+    for (size_t i = 0; i < nPackets; ++i) {
+      Data packet(Name(this->data.getName()).appendNumber(i));
+      this->m_keyChain.sign(packet, signingByKey(this->data.getKeyLocator()->getName()));
+      this->validator.validate(packet,
+        [&] (const Data&) { ++nSuccesses; },
+        [&] (const Data&, const ValidationError& error) {
+          BOOST_CHECK_EQUAL(error.getCode(), ValidationError::Code::CANNOT_RETRIEVE_CERT);
+          ++nFailures;
+        });
+    }
+    this->mockNetworkOperations();
+    return {nSuccesses, nFailures};
+  }
+};
+
+BOOST_FIXTURE_TEST_CASE(CoalesceSuccess, CoalescingFixture<Cert>)
+{
+  auto result = this->validateConcurrently(10);
+  BOOST_CHECK_EQUAL(result.first, 10);
+  BOOST_CHECK_EQUAL(result.second, 0);
+  // one Interest for each level of the certificate chain
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 2);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(CoalesceFailure, T, Failures, CoalescingFixture<T>)
+{
+  auto result = this->validateConcurrently(10);
+  BOOST_CHECK_EQUAL(result.first, 0);
+  BOOST_CHECK_EQUAL(result.second, 10);
+  // first interest + 3 retries, shared by all packets
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
+}
+
+class NonNotifyingCoalescingFixture : public CoalescingFixture<Timeout>
+{
+public:
+  NonNotifyingCoalescingFixture()
+  {
+    // DummyValidationState::fail() does not notify the coalesced requests
+    auto certRequest = make_shared<CertificateRequest>(this->data.getKeyLocator()->getName());
+    this->validator.getFetcher().fetch(certRequest, state,
+      [] (const Certificate&, const shared_ptr<ValidationState>&) {
+        BOOST_ERROR("unexpected success");
+      });
+  }
+
+  void
+  validatePacket(size_t i)
+  {
+    Data packet(Name(this->data.getName()).appendNumber(i));
+    this->m_keyChain.sign(packet, signingByKey(this->data.getKeyLocator()->getName()));
+    this->validator.validate(packet,
+      [] (const Data&) { BOOST_ERROR("unexpected success"); },
+      [this] (const Data&, const ValidationError& error) {
+        BOOST_CHECK_EQUAL(error.getCode(), ValidationError::Code::CANNOT_RETRIEVE_CERT);
+        ++nFailures;
+      });
+  }
+
+public:
+  shared_ptr<DummyValidationState> state = make_shared<DummyValidationState>();
+  size_t nFailures = 0;
+};
+
+BOOST_FIXTURE_TEST_CASE(CoalesceNonNotifyingStateDestroyed, NonNotifyingCoalescingFixture)
+{
+  for (size_t i = 0; i < 5; ++i) {
+    validatePacket(i);
+  }
+  this->mockNetworkOperations();
+  BOOST_CHECK(!boost::logic::indeterminate(state->getOutcome()));
+  BOOST_CHECK_EQUAL(nFailures, 0);
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 4);
+
+  state.reset();
+  BOOST_CHECK_EQUAL(nFailures, 5);
+}
+
+BOOST_FIXTURE_TEST_CASE(CoalesceAfterNonNotifyingState, NonNotifyingCoalescingFixture)
+{
+  for (size_t i = 0; i < 5; ++i) {
+    validatePacket(i);
+  }
+  this->mockNetworkOperations();
+  BOOST_CHECK(!boost::logic::indeterminate(state->getOutcome()));
+  BOOST_CHECK_EQUAL(nFailures, 0);
+
+  // the new request is not coalesced with the finished state, but takes over its waiters
+  validatePacket(5);
+  this->mockNetworkOperations();
+  BOOST_CHECK_EQUAL(nFailures, 6);
+  BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 8);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCertificateFetcherFromNetwork
 BOOST_AUTO_TEST_SUITE_END() // Security
 
@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/public-key-cache.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/key-chain-fixture.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace tests {
+
+using namespace ndn::tests;
+
+class PublicKeyCacheFixture : public KeyChainFixture
+{
+public:
+  PublicKeyCacheFixture()
+  {
+    for (const char* name : {"/TestPublicKeyCache/A", "/TestPublicKeyCache/B", "/TestPublicKeyCache/C"}) {
+      certs.push_back(m_keyChain.createIdentity(name).getDefaultKey().getDefaultCertificate());
+    }
+  }
+
+public:
+  std::vector<Certificate> certs;
+};
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_FIXTURE_TEST_SUITE(TestPublicKeyCache, PublicKeyCacheFixture)
+
+BOOST_AUTO_TEST_CASE(HitAndMiss)
+{
+  PublicKeyCache cache;
+  BOOST_CHECK_EQUAL(cache.getCapacity(), PublicKeyCache::getDefaultCapacity());
+
+  auto key1 = cache.get(certs[0]);
+  BOOST_REQUIRE(key1 != nullptr);
+  BOOST_CHECK_EQUAL(key1->getKeyType(), KeyType::EC);
+  BOOST_CHECK_EQUAL(cache.size(), 1);
+  BOOST_CHECK_EQUAL(cache.getCounters().nHits, 0);
+  BOOST_CHECK_EQUAL(cache.getCounters().nMisses, 1);
+
+  // a copy of the same certificate shares the cached key
+  Certificate copy(certs[0]);
+  BOOST_CHECK_EQUAL(cache.get(copy), key1);
+  BOOST_CHECK_EQUAL(cache.getCounters().nHits, 1);
+  BOOST_CHECK_EQUAL(cache.getCounters().nMisses, 1);
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  BOOST_CHECK_NE(cache.get(certs[0]), key1);
+  BOOST_CHECK_EQUAL(cache.getCounters().nMisses, 2);
+}
+
+BOOST_AUTO_TEST_CASE(SameNameDifferentCertificate)
+{
+  PublicKeyCache cache;
+  auto key1 = cache.get(certs[0]);
+
+  // same name and different key, so the full name differs
+  Data data(certs[1]);
+  data.setName(certs[0].getName());
+  m_keyChain.sign(data, signingWithSha256());
+  Certificate other(std::move(data));
+  BOOST_CHECK_EQUAL(other.getName(), certs[0].getName());
+
+  auto key2 = cache.get(other);
+  BOOST_REQUIRE(key2 != nullptr);
+  BOOST_CHECK_NE(key2, key1);
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+  BOOST_CHECK_EQUAL(cache.getCounters().nHits, 0);
+  BOOST_CHECK_EQUAL(cache.getCounters().nMisses, 2);
+}
+
+BOOST_AUTO_TEST_CASE(Eviction)
+{
+  PublicKeyCache cache(2);
+  cache.get(certs[0]);
+  cache.get(certs[1]);
+  cache.get(certs[0]); // certs[1] becomes least recently used
+  cache.get(certs[2]);
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+  BOOST_CHECK_EQUAL(cache.getCounters().nHits, 1);
+  BOOST_CHECK_EQUAL(cache.getCounters().nMisses, 3);
+
+  cache.get(certs[0]);
+  cache.get(certs[2]);
+  BOOST_CHECK_EQUAL(cache.getCounters().nHits, 3);
+  cache.get(certs[1]);
+  BOOST_CHECK_EQUAL(cache.getCounters().nMisses, 4);
+  BOOST_CHECK_EQUAL(cache.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(MalformedKey)
+{
+  PublicKeyCache cache;
+
+  Data data(certs[0]);
+  const uint8_t junk[] = {0x01, 0x02, 0x03, 0x04};
+  data.setContent(junk, sizeof(junk));
+  m_keyChain.sign(data, signingWithSha256());
+  Certificate malformed(std::move(data));
+
+  BOOST_CHECK(cache.get(malformed) == nullptr);
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  BOOST_CHECK(cache.get(malformed) == nullptr);
+  BOOST_CHECK_EQUAL(cache.getCounters().nMisses, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPublicKeyCache
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
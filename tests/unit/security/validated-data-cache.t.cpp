@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/validated-data-cache.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/unit/clock-fixture.hpp"
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace tests {
+
+using namespace ndn::tests;
+
+class ValidatedDataCacheFixture : public ClockFixture
+{
+public:
+  ValidatedDataCacheFixture()
+    : cache(3, 10_s)
+  {
+  }
+
+  static Name
+  makeFullName(int i)
+  {
+    return Name("/TestValidatedDataCache").appendSegment(i)
+           .appendImplicitSha256Digest(make_shared<Buffer>(32));
+  }
+
+public:
+  ValidatedDataCache cache;
+};
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_FIXTURE_TEST_SUITE(TestValidatedDataCache, ValidatedDataCacheFixture)
+
+BOOST_AUTO_TEST_CASE(RemovalTime)
+{
+  auto notAfter = time::system_clock::now() + 1_h;
+
+  // lifetime is capped to 10 seconds during cache construction
+  cache.insert(makeFullName(1), notAfter);
+  BOOST_CHECK(cache.contains(makeFullName(1)));
+  BOOST_CHECK(!cache.contains(makeFullName(2)));
+
+  advanceClocks(5_s);
+  BOOST_CHECK(cache.contains(makeFullName(1)));
+  advanceClocks(6_s);
+  BOOST_CHECK(!cache.contains(makeFullName(1)));
+
+  // entry is removed when the certificate expires
+  cache.insert(makeFullName(1), time::system_clock::now() + 2_s);
+  BOOST_CHECK(cache.contains(makeFullName(1)));
+  advanceClocks(3_s);
+  BOOST_CHECK(!cache.contains(makeFullName(1)));
+
+  // packets validated by an expired certificate are not cached
+  cache.insert(makeFullName(1), time::system_clock::now() - 1_s);
+  BOOST_CHECK(!cache.contains(makeFullName(1)));
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  auto now = time::system_clock::now();
+  cache.insert(makeFullName(1), now + 1_h);
+  cache.insert(makeFullName(2), now + 3_s);
+  cache.insert(makeFullName(3), now + 1_h);
+  BOOST_CHECK_EQUAL(cache.size(), 3);
+
+  // the entry that would be removed first is evicted
+  cache.insert(makeFullName(4), now + 1_h);
+  BOOST_CHECK_EQUAL(cache.size(), 3);
+  BOOST_CHECK(!cache.contains(makeFullName(2)));
+  BOOST_CHECK(cache.contains(makeFullName(1)));
+  BOOST_CHECK(cache.contains(makeFullName(4)));
+
+  // inserting an existing entry does not evict another one
+  cache.insert(makeFullName(1), now + 1_h);
+  BOOST_CHECK_EQUAL(cache.size(), 3);
+  BOOST_CHECK(cache.contains(makeFullName(3)));
+
+  cache.clear();
+  BOOST_CHECK_EQUAL(cache.size(), 0);
+  BOOST_CHECK(!cache.contains(makeFullName(1)));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestValidatedDataCache
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
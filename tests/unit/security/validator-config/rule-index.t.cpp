@@ -0,0 +1,146 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/validator-config/rule-index.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/unit/security/validator-fixture.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+namespace ndn {
+namespace security {
+inline namespace v2 {
+namespace validator_config {
+namespace tests {
+
+using namespace ndn::tests;
+using namespace ndn::security::v2::tests;
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_AUTO_TEST_SUITE(ValidatorConfig)
+BOOST_AUTO_TEST_SUITE(TestRuleIndex)
+
+BOOST_AUTO_TEST_CASE(LiteralPrefix)
+{
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix(""), "/");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("<a><b>"), "/");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a><b>"), "/a/b");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a><b>$"), "/a/b");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a><b-1_~>[<c><d>]"), "/a/b-1_~");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a><b><>*<KEY>"), "/a/b");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a><b>*<c>"), "/a");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a><b>?"), "/a");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a><b>{2}"), "/a");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a><ksk-.*>"), "/a");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a>(<b>)"), "/a");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a>(<b>|<c>)"), "/");
+  BOOST_CHECK_EQUAL(RuleIndex::getLiteralPrefix("^<a>\\1"), "/");
+}
+
+template<class Packet>
+class RuleIndexFixture : public KeyChainFixture
+{
+public:
+  RuleIndexFixture()
+  {
+    addRule().addFilter(make_unique<RelationNameFilter>("/a/b/c", NameRelation::EQUAL));
+    addRule().addFilter(make_unique<RegexNameFilter>(Regex("^<a><b><>$")));
+    addRule().addFilter(make_unique<RelationNameFilter>("/a/b", NameRelation::IS_STRICT_PREFIX_OF));
+    auto& rule3 = addRule();
+    rule3.addFilter(make_unique<RelationNameFilter>("/x", NameRelation::EQUAL));
+    rule3.addFilter(make_unique<RegexNameFilter>(Regex("^<a><b>$")));
+    addRule().addFilter(make_unique<RegexNameFilter>(Regex("<c>$")));
+    addRule().addFilter(make_unique<RelationNameFilter>("/a", NameRelation::IS_PREFIX_OF));
+    addRule();
+
+    for (const auto& rule : rules) {
+      index.insert(*rule);
+    }
+  }
+
+  Rule&
+  addRule()
+  {
+    rules.push_back(make_unique<Rule>("rule-" + to_string(rules.size()), Packet::getType()));
+    return *rules.back();
+  }
+
+  /**
+   * @brief Find the first matching rule by evaluating all rules in turn
+   */
+  const Rule*
+  matchLinearly(const Name& pktName, const shared_ptr<ValidationState>& state) const
+  {
+    for (const auto& rule : rules) {
+      if (rule->match(Packet::getType(), pktName, state)) {
+        return rule.get();
+      }
+    }
+    return nullptr;
+  }
+
+public:
+  std::vector<unique_ptr<Rule>> rules;
+  RuleIndex index;
+};
+
+using PktTypes = boost::mpl::vector<DataPkt, InterestV02Pkt, InterestV03Pkt>;
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(FirstMatch, PktType, PktTypes, RuleIndexFixture<PktType>)
+{
+  BOOST_CHECK_EQUAL(this->index.size(), 7);
+
+  std::map<std::string, std::string> expected{
+    {"/a/b/c", "rule-0"},
+    {"/a/b/d", "rule-1"},
+    {"/a/b/c/d", "rule-2"},
+    {"/a/b", "rule-3"},
+    {"/x", "rule-3"},
+    {"/y/c", "rule-4"},
+    {"/a", "rule-5"},
+    {"/y", "rule-6"},
+  };
+  for (const auto& item : expected) {
+    BOOST_TEST_CONTEXT(item.first) {
+      Name pktName = PktType::makeName(item.first, this->m_keyChain);
+      auto state = PktType::makeState();
+      const Rule* rule = this->index.match(PktType::getType(), pktName, state);
+      BOOST_REQUIRE(rule != nullptr);
+      BOOST_CHECK_EQUAL(rule->getId(), item.second);
+      BOOST_CHECK_EQUAL(rule, this->matchLinearly(pktName, state));
+    }
+  }
+
+  this->index.clear();
+  auto state = PktType::makeState();
+  BOOST_CHECK(this->index.match(PktType::getType(), PktType::makeName("/a", this->m_keyChain), state) == nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestRuleIndex
+BOOST_AUTO_TEST_SUITE_END() // ValidatorConfig
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // namespace validator_config
+} // inline namespace v2
+} // namespace security
+} // namespace ndn
@@ -157,6 +157,131 @@ BOOST_AUTO_TEST_CASE(TrustedCertCaching)
   face.sentInterests.clear();
 }
 
+BOOST_AUTO_TEST_CASE(PublicKeyCaching)
+{
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+
+  // keys of the anchor and of the retrieved certificate are parsed
+  VALIDATE_SUCCESS(data, "Should get accepted, as signed by the policy-compliant cert");
+  BOOST_CHECK_EQUAL(validator.getPublicKeyCache().size(), 2);
+  BOOST_CHECK_EQUAL(validator.getPublicKeyCache().getCounters().nHits, 0);
+  BOOST_CHECK_EQUAL(validator.getPublicKeyCache().getCounters().nMisses, 2);
+
+  // the key of the cached trusted certificate is reused
+  VALIDATE_SUCCESS(data, "Should get accepted, based on the cached trusted cert");
+  BOOST_CHECK_EQUAL(validator.getPublicKeyCache().getCounters().nHits, 1);
+  BOOST_CHECK_EQUAL(validator.getPublicKeyCache().getCounters().nMisses, 2);
+
+  Data data2("/Security/ValidatorFixture/Sub1/Sub2/Data2");
+  m_keyChain.sign(data2, signingByIdentity(subIdentity));
+  data2.setSignatureValue(make_shared<Buffer>(32));
+  VALIDATE_FAILURE(data2, "Should fail, as the signature is invalid");
+  BOOST_CHECK_EQUAL(lastError.getCode(), ValidationError::INVALID_SIGNATURE);
+  BOOST_CHECK_EQUAL(validator.getPublicKeyCache().getCounters().nHits, 2);
+}
+
+BOOST_AUTO_TEST_CASE(ValidatedDataCaching)
+{
+  validator.setValidatedDataCache(10, 1_h);
+
+  Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
+  m_keyChain.sign(data, signingByIdentity(subIdentity));
+  VALIDATE_SUCCESS(data, "Should get accepted, as signed by the policy-compliant cert");
+  const auto& counters = validator.getPublicKeyCache().getCounters();
+  BOOST_CHECK_EQUAL(counters.nHits + counters.nMisses, 2);
+
+  // a duplicate packet is accepted without verification
+  VALIDATE_SUCCESS(data, "Should get accepted, as validated before");
+  BOOST_CHECK_EQUAL(counters.nHits + counters.nMisses, 2);
+
+  // a packet with the same name but a different digest is verified
+  Data data2(data);
+  data2.setSignatureValue(make_shared<Buffer>(32));
+  VALIDATE_FAILURE(data2, "Should fail, as the signature is invalid");
+  BOOST_CHECK_EQUAL(counters.nHits + counters.nMisses, 3);
+
+  // duplicates within a batch are accepted without verification
+  std::vector<Data> batch{data, data};
+  size_t nSuccesses = 0;
+  validator.validate(batch,
+                     [&] (const Data&) { ++nSuccesses; },
+                     [] (const Data&, const ValidationError& error) { BOOST_ERROR(error); });
+  BOOST_CHECK_EQUAL(nSuccesses, 2);
+  BOOST_CHECK_EQUAL(counters.nHits + counters.nMisses, 3);
+
+  // the cache is cleared together with the verified certificates
+  validator.resetVerifiedCertificates();
+  VALIDATE_SUCCESS(data, "Should get accepted, after verification");
+  BOOST_CHECK_EQUAL(counters.nHits + counters.nMisses, 5);
+  VALIDATE_SUCCESS(data, "Should get accepted, as validated before");
+  BOOST_CHECK_EQUAL(counters.nHits + counters.nMisses, 5);
+
+  // entries expire after the maximum lifetime
+  this->advanceClocks(1_h, 2);
+  VALIDATE_SUCCESS(data, "Should get accepted, after verification");
+  BOOST_CHECK_EQUAL(counters.nHits + counters.nMisses, 7);
+
+  // with the cache disabled, only the signature of the packet is verified, by the trusted cert
+  validator.setValidatedDataCache(0);
+  VALIDATE_SUCCESS(data, "Should get accepted, after verification");
+  BOOST_CHECK_EQUAL(counters.nHits + counters.nMisses, 8);
+}
+
+BOOST_AUTO_TEST_CASE(Batch)
+{
+  std::vector<Data> batch;
+  for (int i = 0; i < 10; ++i) {
+    Data data(Name("/Security/ValidatorFixture/Sub1/Sub2/Data").appendSegment(i));
+    m_keyChain.sign(data, signingByIdentity(subIdentity));
+    batch.push_back(data);
+  }
+  batch[3].setSignatureValue(make_shared<Buffer>(32));
+  for (int i = 0; i < 3; ++i) {
+    Data data(Name("/Security/ValidatorFixture/Sub1/Sub2/SelfSigned").appendSegment(i));
+    m_keyChain.sign(data, signingByIdentity(subSelfSignedIdentity));
+    batch.push_back(data);
+  }
+  Data outOfNamespace("/Security/OtherIdentity/Data");
+  m_keyChain.sign(outOfNamespace, signingByIdentity(subIdentity));
+  batch.push_back(outOfNamespace);
+
+  for (size_t nThreads : {0, 2}) {
+    BOOST_TEST_CONTEXT("nThreads=" << nThreads) {
+      validator.setVerificationThreads(m_io, nThreads);
+
+      std::vector<Name> accepted;
+      std::map<Name, ValidationError::Code> rejected;
+      validator.validate(batch,
+        [&] (const Data& data) { accepted.push_back(data.getName()); },
+        [&] (const Data& data, const ValidationError& error) {
+          rejected.emplace(data.getName(), static_cast<ValidationError::Code>(error.getCode()));
+        });
+      mockNetworkOperations();
+      validator.setVerificationThreads(m_io, 0); // wait for pending verifications
+      advanceClocks(1_ms);
+
+      BOOST_CHECK_EQUAL(accepted.size(), 9);
+      BOOST_REQUIRE_EQUAL(rejected.size(), 5);
+      BOOST_CHECK_EQUAL(rejected.at(batch[3].getName()), ValidationError::INVALID_SIGNATURE);
+      BOOST_CHECK_EQUAL(rejected.at(outOfNamespace.getName()), ValidationError::INVALID_KEY_LOCATOR);
+      auto selfSignedError = rejected.at(batch[10].getName());
+      BOOST_CHECK_EQUAL(rejected.at(batch[11].getName()), selfSignedError);
+      BOOST_CHECK_EQUAL(rejected.at(batch[12].getName()), selfSignedError);
+
+      if (nThreads == 0) {
+        // one certificate retrieval per signing key
+        BOOST_CHECK_EQUAL(face.sentInterests.size(), 2);
+      }
+      else {
+        // certificates have been cached during the first iteration
+        BOOST_CHECK_EQUAL(face.sentInterests.size(), 0);
+      }
+      face.sentInterests.clear();
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ResetVerifiedCertificates)
 {
   Data data("/Security/ValidatorFixture/Sub1/Sub2/Data");
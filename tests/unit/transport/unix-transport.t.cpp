@@ -20,9 +20,15 @@
  */
 
 #include "ndn-cxx/transport/unix-transport.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
 
 #include "tests/boost-test.hpp"
 
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+
 namespace ndn {
 namespace tests {
 
@@ -51,6 +57,197 @@ BOOST_AUTO_TEST_CASE(GetSocketNameFromUri)
                         });
 }
 
+class UnixTransportFixture
+{
+public:
+  UnixTransportFixture()
+    : socketPath((boost::filesystem::path(UNIT_TESTS_TMPDIR) / "unix-transport.sock").string())
+    , acceptor(io)
+    , serverSocket(io)
+    , transport(socketPath)
+  {
+    boost::filesystem::create_directories(UNIT_TESTS_TMPDIR);
+    boost::filesystem::remove(socketPath);
+    acceptor.open();
+    acceptor.bind(boost::asio::local::stream_protocol::endpoint(socketPath));
+    acceptor.listen();
+    acceptor.async_accept(serverSocket, [this] (const auto& error) {
+      BOOST_REQUIRE(!error);
+      isAccepted = true;
+    });
+  }
+
+  ~UnixTransportFixture()
+  {
+    boost::filesystem::remove(socketPath);
+  }
+
+  /** \brief Run the io_service until the transport is connected and the server side of the
+   *         connection is accepted.
+   */
+  void
+  waitForConnection()
+  {
+    while (!(isAccepted && transport.isConnected()) && io.run_one() > 0) {
+    }
+    BOOST_REQUIRE(isAccepted && transport.isConnected());
+  }
+
+protected:
+  const std::string socketPath;
+  boost::asio::io_service io;
+  boost::asio::local::stream_protocol::acceptor acceptor;
+  boost::asio::local::stream_protocol::socket serverSocket;
+  UnixTransport transport;
+  std::vector<Block> received;
+  bool isAccepted = false;
+};
+
+BOOST_FIXTURE_TEST_CASE(SendReceive, UnixTransportFixture)
+{
+  bool isOutputRead = false;
+  transport.connect(io, [&] (const Block& wire) {
+    received.push_back(wire);
+    if (received.size() == 3 && isOutputRead) {
+      io.stop();
+    }
+  });
+
+  // packets submitted in a burst are coalesced into fewer gather writes
+  const size_t nPackets = 200;
+  Buffer expected;
+  for (size_t i = 0; i < nPackets; ++i) {
+    Block header = makeNonNegativeIntegerBlock(tlv::ContentType, i);
+    Block payload = makeStringBlock(tlv::Content, "payload " + to_string(i));
+    expected.insert(expected.end(), header.begin(), header.end());
+    expected.insert(expected.end(), payload.begin(), payload.end());
+    transport.send(header, payload);
+  }
+  waitForConnection();
+
+  Buffer output(expected.size());
+  boost::asio::async_read(serverSocket, boost::asio::buffer(output), [&] (const auto& error, size_t) {
+    BOOST_REQUIRE(!error);
+    isOutputRead = true;
+    if (received.size() == 3) {
+      io.stop();
+    }
+  });
+
+  // the server sends three elements in one write, the last one split across two writes
+  Block b1 = makeStringBlock(tlv::Content, "first");
+  Block b2 = makeStringBlock(tlv::Content, "second");
+  Block b3 = makeStringBlock(tlv::Content, "third");
+  std::vector<boost::asio::const_buffer> firstWrite{b1, b2, {b3.wire(), 2}};
+  boost::asio::async_write(serverSocket, firstWrite, [&] (const auto& error, size_t) {
+    BOOST_REQUIRE(!error);
+    boost::asio::async_write(serverSocket, boost::asio::buffer(b3.wire() + 2, b3.size() - 2),
+                             [] (const auto& error, size_t) { BOOST_REQUIRE(!error); });
+  });
+
+  io.run_for(std::chrono::seconds(4));
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), expected.begin(), expected.end());
+  const auto& counters = transport.getCounters();
+  BOOST_CHECK_EQUAL(counters.nOutBytes, expected.size());
+  BOOST_CHECK_GE(counters.nWriteBatches, 1);
+  BOOST_CHECK_LT(counters.nWriteBatches, nPackets);
+  BOOST_CHECK_EQUAL(counters.maxQueueDepth, 2 * nPackets);
+
+  BOOST_REQUIRE_EQUAL(received.size(), 3);
+  BOOST_CHECK_EQUAL(received[0], b1);
+  BOOST_CHECK_EQUAL(received[1], b2);
+  BOOST_CHECK_EQUAL(received[2], b3);
+  // received elements refer to the same input chunk, even if they arrived in different reads
+  BOOST_CHECK(received[0].getBuffer() == received[1].getBuffer());
+  BOOST_CHECK(received[0].getBuffer() == received[2].getBuffer());
+  BOOST_CHECK_EQUAL(counters.nInBytes, b1.size() + b2.size() + b3.size());
+  BOOST_CHECK_EQUAL(counters.nInFrames, 3);
+  BOOST_CHECK_EQUAL(counters.nInChunkRelocations, 0);
+
+  transport.close();
+}
+
+BOOST_FIXTURE_TEST_CASE(ReceiveAcrossChunks, UnixTransportFixture)
+{
+  // enough data to fill several input chunks, with elements straddling chunk boundaries
+  const size_t nElements = 40;
+  std::vector<Block> sent;
+  Buffer stream;
+  for (size_t i = 0; i < nElements; ++i) {
+    sent.push_back(makeStringBlock(tlv::Content, std::string(1000 + i * 97, 'a' + i % 26)));
+    stream.insert(stream.end(), sent.back().begin(), sent.back().end());
+  }
+
+  transport.connect(io, [this] (const Block& wire) {
+    received.push_back(wire);
+    if (received.size() == nElements) {
+      io.stop();
+    }
+  });
+  waitForConnection();
+  transport.resume();
+  boost::asio::async_write(serverSocket, boost::asio::buffer(stream),
+                           [] (const auto& error, size_t) { BOOST_REQUIRE(!error); });
+
+  io.run_for(std::chrono::seconds(4));
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.begin(), received.end(), sent.begin(), sent.end());
+  const auto& counters = transport.getCounters();
+  BOOST_CHECK_EQUAL(counters.nInBytes, stream.size());
+  BOOST_CHECK_EQUAL(counters.nInFrames, nElements);
+
+  transport.close();
+}
+
+BOOST_FIXTURE_TEST_CASE(ReceiveAfterPauseResume, UnixTransportFixture)
+{
+  Block b1 = makeStringBlock(tlv::Content, "first");
+  Block b2 = makeStringBlock(tlv::Content, std::string(b1.value_size(), 'X'));
+
+  transport.connect(io, [this] (const Block& wire) {
+    received.push_back(wire);
+    io.stop();
+  });
+  waitForConnection();
+  transport.resume();
+
+  boost::asio::write(serverSocket, boost::asio::buffer(b1.wire(), b1.size()));
+  io.run_for(std::chrono::seconds(4));
+  BOOST_REQUIRE_EQUAL(received.size(), 1);
+
+  // the application still holds the first element when the transport is paused and resumed
+  transport.pause();
+  transport.resume();
+  io.restart();
+  boost::asio::write(serverSocket, boost::asio::buffer(b2.wire(), b2.size()));
+  io.run_for(std::chrono::seconds(4));
+
+  BOOST_REQUIRE_EQUAL(received.size(), 2);
+  BOOST_CHECK_EQUAL(received[0], b1);
+  BOOST_CHECK_EQUAL(received[1], b2);
+
+  transport.close();
+}
+
+BOOST_FIXTURE_TEST_CASE(ReceiveOversizeElement, UnixTransportFixture)
+{
+  Block small = makeStringBlock(tlv::Content, "small");
+  Block oversize = makeStringBlock(tlv::Content, std::string(MAX_NDN_PACKET_SIZE, 'x'));
+  BOOST_REQUIRE_GT(oversize.size(), MAX_NDN_PACKET_SIZE);
+
+  transport.connect(io, [this] (const Block& wire) { received.push_back(wire); });
+  waitForConnection();
+  transport.resume();
+  std::vector<boost::asio::const_buffer> write{small, oversize};
+  boost::asio::async_write(serverSocket, write, [] (const auto&, size_t) {});
+
+  BOOST_CHECK_THROW(io.run_for(std::chrono::seconds(4)), Transport::Error);
+  BOOST_CHECK(!transport.isConnected());
+  BOOST_REQUIRE_EQUAL(received.size(), 1);
+  BOOST_CHECK_EQUAL(received[0], small);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnixTransport
 BOOST_AUTO_TEST_SUITE_END() // Transport
 
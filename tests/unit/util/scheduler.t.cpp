@@ -203,8 +203,206 @@ BOOST_AUTO_TEST_CASE(CancelAllWithScopedEventId) // Bug 3691
   BOOST_CHECK(true);
 }
 
+BOOST_AUTO_TEST_CASE(CancelAllWithCancelingCallbackDestructor)
+{
+  for (auto backend : {Scheduler::Backend::PRIORITY_QUEUE, Scheduler::Backend::TIMING_WHEEL}) {
+    BOOST_TEST_CONTEXT("backend=" << static_cast<int>(backend)) {
+      // the callback of the second event owns ScopedEventIds of the first and third events,
+      // which are canceled when the callback is destroyed
+      auto scheduleWithCanceler = [] (Scheduler& sched, int& nDestroyed) {
+        EventId first = sched.schedule(10_ms, [] { BOOST_ERROR("This event should have been cancelled"); });
+        auto cancelFirst = make_shared<ScopedEventId>(first);
+        auto cancelThird = make_shared<ScopedEventId>();
+        auto countDestroyed = shared_ptr<void>(nullptr, [&nDestroyed] (void*) { ++nDestroyed; });
+        sched.schedule(20_ms, [cancelFirst, cancelThird, countDestroyed] {
+          BOOST_ERROR("This event should have been cancelled");
+        });
+        *cancelThird = sched.schedule(30_ms, [] { BOOST_ERROR("This event should have been cancelled"); });
+        return first;
+      };
+
+      int nDestroyed = 0;
+      Scheduler sched(m_io, backend);
+      EventId first = scheduleWithCanceler(sched, nDestroyed);
+      sched.cancelAllEvents();
+      BOOST_CHECK_EQUAL(nDestroyed, 1);
+      BOOST_CHECK(!first);
+
+      // the event pool is still usable
+      int nInvoked = 0;
+      for (int i = 0; i < 3; ++i) {
+        sched.schedule(10_ms, [&nInvoked] { ++nInvoked; });
+      }
+      advanceClocks(10_ms, 5);
+      BOOST_CHECK_EQUAL(nInvoked, 3);
+
+      // the same applies when the scheduler is destructed
+      {
+        Scheduler sched2(m_io, backend);
+        first = scheduleWithCanceler(sched2, nDestroyed);
+      }
+      BOOST_CHECK_EQUAL(nDestroyed, 2);
+      BOOST_CHECK(!first);
+      advanceClocks(10_ms, 5);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TimerSlack)
+{
+  scheduler.setTimerSlack(10_ms);
+
+  size_t count = 0;
+  scheduler.schedule(100_ms, [&] { ++count; });
+  scheduler.schedule(105_ms, [&] { ++count; });
+  scheduler.schedule(108_ms, [&] { ++count; });
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nArms, 1);
+
+  advanceClocks(1_ms, 109);
+  BOOST_CHECK_EQUAL(count, 0);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(count, 3);
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nArms, 1);
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nWakeups, 1);
+
+  // an earlier event beyond the slack resets the timer
+  scheduler.schedule(100_ms, [&] { ++count; });
+  scheduler.schedule(50_ms, [&] { ++count; });
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nArms, 3);
+  advanceClocks(10_ms, 20);
+  BOOST_CHECK_EQUAL(count, 5);
+}
+
+BOOST_AUTO_TEST_CASE(TimerCounters)
+{
+  bool isCallbackInvoked = false;
+  EventId eid = scheduler.schedule(10_ms, [] { BOOST_ERROR("This event should not have been fired"); });
+  scheduler.schedule(20_ms, [&] { isCallbackInvoked = true; });
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nArms, 1);
+
+  // canceling the earliest event does not reset the timer
+  eid.cancel();
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nArms, 1);
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nCancels, 0);
+
+  advanceClocks(1_ms, 25);
+  BOOST_CHECK(isCallbackInvoked);
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nArms, 2);
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nWakeups, 2);
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nEmptyWakeups, 1);
+
+  // canceling the last event cancels the timer
+  eid = scheduler.schedule(10_ms, [] { BOOST_ERROR("This event should not have been fired"); });
+  eid.cancel();
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nArms, 3);
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nCancels, 1);
+  advanceClocks(1_ms, 25);
+  BOOST_CHECK_EQUAL(scheduler.getTimerCounters().nWakeups, 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // General
 
+class TimingWheelFixture : public ndn::tests::IoFixture
+{
+protected:
+  Scheduler scheduler{m_io, Scheduler::Backend::TIMING_WHEEL};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TimingWheel, TimingWheelFixture)
+
+BOOST_AUTO_TEST_CASE(Events)
+{
+  std::vector<int> order;
+  scheduler.schedule(500_ms, [&] { order.push_back(2); });
+  EventId i = scheduler.schedule(1_s, [] { BOOST_ERROR("This event should not have been fired"); });
+  scheduler.schedule(250_ms, [&] { order.push_back(1); });
+  i.cancel();
+  BOOST_CHECK(!i);
+
+  advanceClocks(249_ms);
+  BOOST_CHECK(order.empty());
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(order.size(), 1);
+  advanceClocks(25_ms, 1000_ms);
+  std::vector<int> expected{1, 2};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(SubTickDelay)
+{
+  bool isCallbackInvoked = false;
+  scheduler.schedule(1500_us, [&] { isCallbackInvoked = true; });
+
+  // the event never executes before its delay has elapsed
+  advanceClocks(1_ms);
+  BOOST_CHECK(!isCallbackInvoked);
+  advanceClocks(1_ms);
+  BOOST_CHECK(isCallbackInvoked);
+}
+
+BOOST_AUTO_TEST_CASE(LongDelays)
+{
+  std::vector<int> order;
+  scheduler.schedule(48_h, [&] { order.push_back(4); });
+  scheduler.schedule(1_h, [&] { order.push_back(3); });
+  scheduler.schedule(10_s, [&] { order.push_back(2); });
+  scheduler.schedule(300_ms, [&] { order.push_back(1); });
+
+  advanceClocks(1_s);
+  BOOST_CHECK_EQUAL(order.size(), 1);
+  advanceClocks(10_s);
+  BOOST_CHECK_EQUAL(order.size(), 2);
+  advanceClocks(1_h);
+  BOOST_CHECK_EQUAL(order.size(), 3);
+  advanceClocks(1_h, 47);
+  BOOST_CHECK_EQUAL(order.size(), 4);
+  std::vector<int> expected{1, 2, 3, 4};
+  BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleDuringCallback)
+{
+  size_t count = 0;
+  EventId eid;
+  std::function<void()> reschedule = [&] {
+    BOOST_CHECK(!eid);
+    if (++count < 5) {
+      eid = scheduler.schedule(100_ms, reschedule);
+    }
+  };
+  eid = scheduler.schedule(0_s, reschedule);
+  scheduler.schedule(0_s, [&] { eid.cancel(); eid = scheduler.schedule(0_s, reschedule); });
+
+  advanceClocks(50_ms, 1000_ms);
+  BOOST_CHECK_EQUAL(count, 5);
+}
+
+BOOST_AUTO_TEST_CASE(CallbackException)
+{
+  scheduler.schedule(10_ms, [] { throw std::runtime_error("callback"); });
+  bool isCallbackInvoked = false;
+  scheduler.schedule(20_ms, [&isCallbackInvoked] { isCallbackInvoked = true; });
+
+  BOOST_CHECK_THROW(advanceClocks(6_ms, 2), std::runtime_error);
+  advanceClocks(6_ms, 2);
+  BOOST_CHECK(isCallbackInvoked);
+}
+
+BOOST_AUTO_TEST_CASE(CancelAll)
+{
+  ScopedEventId eid = scheduler.schedule(10_ms, [] { BOOST_ERROR("This event should have been cancelled"); });
+  scheduler.schedule(5_s, [] { BOOST_ERROR("This event should have been cancelled"); });
+  scheduler.cancelAllEvents();
+  eid.cancel(); // should not crash
+
+  bool isCallbackInvoked = false;
+  scheduler.schedule(10_ms, [&isCallbackInvoked] { isCallbackInvoked = true; });
+  advanceClocks(10_ms, 1000);
+  BOOST_CHECK(isCallbackInvoked);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TimingWheel
+
 BOOST_AUTO_TEST_SUITE(EventId)
 
 using scheduler::EventId;
@@ -279,6 +477,53 @@ BOOST_AUTO_TEST_CASE(DuringCallback)
   BOOST_CHECK(isCallbackInvoked);
 }
 
+BOOST_AUTO_TEST_CASE(CancelDuringCallback)
+{
+  bool isCallbackInvoked = false;
+  EventId eid;
+  EventId eid2 = scheduler.schedule(10_ms, [] { BOOST_ERROR("This event should have been cancelled"); });
+  eid = scheduler.schedule(5_ms, [&] {
+    isCallbackInvoked = true;
+    eid.cancel(); // no effect
+    BOOST_CHECK(eid2);
+    eid2.cancel();
+    BOOST_CHECK(!eid2);
+  });
+
+  this->advanceClocks(5_ms, 3);
+  BOOST_CHECK(isCallbackInvoked);
+}
+
+BOOST_AUTO_TEST_CASE(StaleAfterReuse)
+{
+  EventId stale = scheduler.schedule(10_ms, []{});
+  stale.cancel();
+
+  // the record of the canceled event is reused for the next event
+  bool isCallbackInvoked = false;
+  EventId eid = scheduler.schedule(10_ms, [&isCallbackInvoked] { isCallbackInvoked = true; });
+  BOOST_CHECK(!stale);
+  BOOST_CHECK(stale != eid);
+  stale.cancel();
+  BOOST_CHECK(eid);
+
+  this->advanceClocks(6_ms, 2);
+  BOOST_CHECK(isCallbackInvoked);
+}
+
+BOOST_AUTO_TEST_CASE(AfterSchedulerDestruction)
+{
+  EventId eid;
+  {
+    Scheduler sched(m_io);
+    eid = sched.schedule(10_ms, []{});
+    BOOST_CHECK(eid);
+  }
+  BOOST_CHECK(!eid);
+  BOOST_CHECK(eid == EventId{});
+  eid.cancel(); // no effect
+}
+
 BOOST_AUTO_TEST_CASE(Reset)
 {
   bool isCallbackInvoked = false;
@@ -317,6 +562,21 @@ BOOST_AUTO_TEST_CASE(Destruct)
   BOOST_CHECK_EQUAL(hit, 0);
 }
 
+BOOST_AUTO_TEST_CASE(DestructAfterExpiration)
+{
+  int hit = 0, hit2 = 0;
+  {
+    ScopedEventId se = scheduler.schedule(10_ms, [&] { ++hit; });
+    this->advanceClocks(1_ms, 15);
+    BOOST_CHECK_EQUAL(hit, 1);
+
+    // the record of the expired event is reused, and the new event must not be canceled by se
+    scheduler.schedule(10_ms, [&] { ++hit2; });
+  } // se goes out of scope
+  this->advanceClocks(1_ms, 15);
+  BOOST_CHECK_EQUAL(hit2, 1);
+}
+
 BOOST_AUTO_TEST_CASE(Assign)
 {
   int hit1 = 0, hit2 = 0;